@@ -50,6 +50,23 @@ protected:
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
+	/**
+	 * Drivers whose synth queues events with a sample timestamp return true.
+	 * For those, readBuffer() runs all ticks of a block first, so that the
+	 * driver can timestamp the events sent by each tick, and then generates
+	 * the whole block in one go. The synth is expected to apply each event
+	 * at its exact position in the block.
+	 */
+	virtual bool hasEventQueue() const { return false; }
+
+	/**
+	 * Called by readBuffer() on the mixer thread around each tick, for
+	 * drivers with an event queue. sampleOffset is the position of the tick
+	 * in samples from the start of the block being generated.
+	 */
+	virtual void startTick(int sampleOffset) {}
+	virtual void endTick() {}
+
 public:
 	MidiDriver_Emulated(Audio::Mixer *mixer) :
 		_mixer(mixer),
@@ -93,6 +110,31 @@ public:
 		int len = numSamples / stereoFactor;
 		int step;
 
+		if (hasEventQueue()) {
+			int offset = 0;
+			while (offset < len) {
+				step = len - offset;
+				if (step > (_nextTick >> FIXP_SHIFT))
+					step = (_nextTick >> FIXP_SHIFT);
+
+				offset += step;
+				_nextTick -= step << FIXP_SHIFT;
+				if (!(_nextTick >> FIXP_SHIFT)) {
+					startTick(offset);
+					if (_timerProc)
+						(*_timerProc)(_timerParam);
+
+					onTimer();
+					endTick();
+
+					_nextTick += _samplesPerTick;
+				}
+			}
+
+			generateSamples(data, len);
+			return numSamples;
+		}
+
 		do {
 			step = len;
 			if (step > (_nextTick >> FIXP_SHIFT))
@@ -37,6 +37,8 @@
 #include "common/error.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/mutex.h"
+#include "common/queue.h"
 #include "common/system.h"
 #include "common/util.h"
 #include "common/archive.h"
@@ -102,8 +104,33 @@ private:
 
 	int _outputRate;
 
+	// Number of sample frames rendered by the synth so far, which is the time
+	// base of its event queue
+	uint32 _renderedFrames;
+
+	// Events are only handed to the synth by generateSamples() on the mixer
+	// thread, since its event queue supports a single producer. Events sent
+	// by the player during a tick wait for the tick's position. All other
+	// events are applied before the next rendered sample.
+	struct QueuedEvent {
+		uint32 timestamp;
+		uint32 msg;
+		Common::Array<byte> sysex;	// framed, empty for short messages
+	};
+	Common::Queue<QueuedEvent> _tickEvents;
+	Common::Queue<QueuedEvent> _immediateEvents;
+	bool _inTick;
+	uint32 _tickTimestamp;
+	Common::Mutex _eventMutex;	// event queues and tick state
+
+	void queueEvent(QueuedEvent &event);
+	bool playEvent(const QueuedEvent &event, uint32 timestamp);
+
 protected:
 	void generateSamples(int16 *buf, int len);
+	bool hasEventQueue() const { return true; }
+	void startTick(int sampleOffset);
+	void endTick();
 
 public:
 	bool _initializing;
@@ -145,6 +172,9 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	// rely on Mixer to convert.
 	_outputRate = 32000; //_mixer->getOutputRate();
 	_initializing = false;
+	_renderedFrames = 0;
+	_inTick = false;
+	_tickTimestamp = 0;
 
 	// Initialized in open()
 	_controlROM = NULL;
@@ -208,6 +238,7 @@ int MidiDriver_MT32::open() {
 	_pcmROM = MT32Emu::ROMImage::makeROMImage(_pcmFile);
 	if (!_synth->open(*_controlROM, *_pcmROM))
 		return MERR_DEVICE_NOT_AVAILABLE;
+	_renderedFrames = 0;
 
 	double gain = (double)ConfMan.getInt("midi_gain") / 100.0;
 	_synth->setOutputGain(1.0f * gain);
@@ -228,7 +259,9 @@ int MidiDriver_MT32::open() {
 }
 
 void MidiDriver_MT32::send(uint32 b) {
-	_synth->playMsg(b);
+	QueuedEvent event;
+	event.msg = b;
+	queueEvent(event);
 }
 
 void MidiDriver_MT32::setPitchBendRange(byte channel, uint range) {
@@ -249,13 +282,50 @@ void MidiDriver_MT32::setPitchBendRange(byte channel, uint range) {
 }
 
 void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
+	// Only framed messages can be queued, so that they stay in order with
+	// the other events
+	QueuedEvent event;
+	event.msg = 0;
 	if (msg[0] == 0xf0) {
-		_synth->playSysex(msg, length);
+		event.sysex.resize(length);
+		memcpy(event.sysex.begin(), msg, length);
+	} else {
+		event.sysex.resize(length + 2);
+		event.sysex[0] = 0xf0;
+		memcpy(event.sysex.begin() + 1, msg, length);
+		event.sysex[length + 1] = 0xf7;
+	}
+	queueEvent(event);
+}
+
+void MidiDriver_MT32::queueEvent(QueuedEvent &event) {
+	Common::StackLock lock(_eventMutex);
+	if (_inTick) {
+		event.timestamp = _tickTimestamp;
+		_tickEvents.push(event);
 	} else {
-		_synth->playSysexWithoutFraming(msg, length);
+		event.timestamp = 0;
+		_immediateEvents.push(event);
 	}
 }
 
+bool MidiDriver_MT32::playEvent(const QueuedEvent &event, uint32 timestamp) {
+	if (event.sysex.empty())
+		return _synth->playMsg(event.msg, timestamp);
+	return _synth->playSysex(event.sysex.begin(), event.sysex.size(), timestamp);
+}
+
+void MidiDriver_MT32::startTick(int sampleOffset) {
+	Common::StackLock lock(_eventMutex);
+	_inTick = true;
+	_tickTimestamp = _renderedFrames + sampleOffset;
+}
+
+void MidiDriver_MT32::endTick() {
+	Common::StackLock lock(_eventMutex);
+	_inTick = false;
+}
+
 void MidiDriver_MT32::close() {
 	if (!_isOpen)
 		return;
@@ -267,11 +337,50 @@ void MidiDriver_MT32::close() {
 	_mixer->stopHandle(_mixerSoundHandle);
 
 	_synth->close();
+	_tickEvents.clear();
+	_immediateEvents.clear();
 	deleteMuntStructures();
 }
 
 void MidiDriver_MT32::generateSamples(int16 *data, int len) {
-	_synth->render(data, len);
+	while (len > 0) {
+		int step = len;
+		{
+			Common::StackLock lock(_eventMutex);
+			bool full = false;
+
+			// Immediate events go first, so that they never wait behind tick
+			// events for a later position in the synth's queue
+			while (!_immediateEvents.empty()) {
+				if (!playEvent(_immediateEvents.front(), _renderedFrames)) {
+					full = true;
+					break;
+				}
+				_immediateEvents.pop();
+			}
+
+			// Tick events only enter the synth's queue once they are due
+			while (!full && !_tickEvents.empty() && (int32)(_tickEvents.front().timestamp - _renderedFrames) <= 0) {
+				if (!playEvent(_tickEvents.front(), _tickEvents.front().timestamp)) {
+					full = true;
+					break;
+				}
+				_tickEvents.pop();
+			}
+
+			// The synth handles at most one due event per sample, so a full
+			// queue gets room after rendering a single sample
+			if (full)
+				step = 1;
+			else if (!_tickEvents.empty())
+				step = MIN<int>(len, _tickEvents.front().timestamp - _renderedFrames);
+		}
+
+		_synth->render(data, step);
+		_renderedFrames += step;
+		data += step * 2;
+		len -= step;
+	}
 }
 
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
@@ -303,120 +412,6 @@ MidiChannel *MidiDriver_MT32::getPercussionChannel() {
 	return &_midiChannels[9];
 }
 
-// This code should be used when calling the timer callback from the mixer thread is undesirable.
-// Note that it results in less accurate timing.
-#if 0
-class MidiEvent_MT32 {
-public:
-	MidiEvent_MT32 *_next;
-	uint32 _msg; // 0xFFFFFFFF indicates a sysex message
-	byte *_data;
-	uint32 _len;
-
-	MidiEvent_MT32(uint32 msg, byte *data, uint32 len) {
-		_msg = msg;
-		if (len > 0) {
-			_data = new byte[len];
-			memcpy(_data, data, len);
-		}
-		_len = len;
-		_next = NULL;
-	}
-
-	MidiEvent_MT32() {
-		if (_len > 0)
-			delete _data;
-	}
-};
-
-class MidiDriver_ThreadedMT32 : public MidiDriver_MT32 {
-private:
-	OSystem::Mutex _eventMutex;
-	MidiEvent_MT32 *_events;
-	TimerManager::TimerProc _timer_proc;
-
-	void pushMidiEvent(MidiEvent_MT32 *event);
-	MidiEvent_MT32 *popMidiEvent();
-
-protected:
-	void send(uint32 b);
-	void sysEx(const byte *msg, uint16 length);
-
-public:
-	MidiDriver_ThreadedMT32(Audio::Mixer *mixer);
-
-	void onTimer();
-	void close();
-	void setTimerCallback(void *timer_param, TimerManager::TimerProc timer_proc);
-};
-
-
-MidiDriver_ThreadedMT32::MidiDriver_ThreadedMT32(Audio::Mixer *mixer) : MidiDriver_MT32(mixer) {
-	_events = NULL;
-	_timer_proc = NULL;
-}
-
-void MidiDriver_ThreadedMT32::close() {
-	MidiDriver_MT32::close();
-	while ((popMidiEvent() != NULL)) {
-		// Just eat any leftover events
-	}
-}
-
-void MidiDriver_ThreadedMT32::setTimerCallback(void *timer_param, TimerManager::TimerProc timer_proc) {
-	if (!_timer_proc || !timer_proc) {
-		if (_timer_proc)
-			_vm->_timer->removeTimerProc(_timer_proc);
-		_timer_proc = timer_proc;
-		if (timer_proc)
-			_vm->_timer->installTimerProc(timer_proc, getBaseTempo(), timer_param, "MT32tempo");
-	}
-}
-
-void MidiDriver_ThreadedMT32::pushMidiEvent(MidiEvent_MT32 *event) {
-	Common::StackLock lock(_eventMutex);
-	if (_events == NULL) {
-		_events = event;
-	} else {
-		MidiEvent_MT32 *last = _events;
-		while (last->_next != NULL)
-			last = last->_next;
-		last->_next = event;
-	}
-}
-
-MidiEvent_MT32 *MidiDriver_ThreadedMT32::popMidiEvent() {
-	Common::StackLock lock(_eventMutex);
-	MidiEvent_MT32 *event;
-	event = _events;
-	if (event != NULL)
-		_events = event->_next;
-	return event;
-}
-
-void MidiDriver_ThreadedMT32::send(uint32 b) {
-	MidiEvent_MT32 *event = new MidiEvent_MT32(b, NULL, 0);
-	pushMidiEvent(event);
-}
-
-void MidiDriver_ThreadedMT32::sysEx(const byte *msg, uint16 length) {
-	MidiEvent_MT32 *event = new MidiEvent_MT32(0xFFFFFFFF, msg, length);
-	pushMidiEvent(event);
-}
-
-void MidiDriver_ThreadedMT32::onTimer() {
-	MidiEvent_MT32 *event;
-	while ((event = popMidiEvent()) != NULL) {
-		if (event->_msg == 0xFFFFFFFF) {
-			MidiDriver_MT32::sysEx(event->_data, event->_len);
-		} else {
-			MidiDriver_MT32::send(event->_msg);
-		}
-		delete event;
-	}
-}
-#endif
-
 
 // Plugin interface
 
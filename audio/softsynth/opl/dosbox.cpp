@@ -144,7 +144,7 @@ uint8 Chip::read() {
 	return ret;
 }
 
-OPL::OPL(Config::OplType type) : _type(type), _rate(0), _emulator(0) {
+OPL::OPL(Config::OplType type) : _type(type), _rate(0), _emulator(0), _tempBuffer(0), _tempBufferSize(0) {
 }
 
 OPL::~OPL() {
@@ -154,6 +154,9 @@ OPL::~OPL() {
 void OPL::free() {
 	delete _emulator;
 	_emulator = 0;
+	delete[] _tempBuffer;
+	_tempBuffer = 0;
+	_tempBufferSize = 0;
 }
 
 bool OPL::init(int rate) {
@@ -313,34 +316,22 @@ void OPL::readBuffer(int16 *buffer, int length) {
 	if (_type != Config::kOpl2)
 		length >>= 1;
 
-	const uint bufferLength = 512;
-	int32 tempBuffer[bufferLength * 2];
-
-	if (_emulator->opl3Active) {
-		while (length > 0) {
-			const uint readSamples = MIN<uint>(length, bufferLength);
-
-			_emulator->GenerateBlock3(readSamples, tempBuffer);
-
-			for (uint i = 0; i < (readSamples << 1); ++i)
-				buffer[i] = tempBuffer[i];
-
-			buffer += (readSamples << 1);
-			length -= readSamples;
-		}
-	} else {
-		while (length > 0) {
-			const uint readSamples = MIN<uint>(length, bufferLength << 1);
-
-			_emulator->GenerateBlock2(readSamples, tempBuffer);
+	// Generate the whole request in one go, instead of splitting it into
+	// small pieces. DBOPL itself only splits the block at LFO steps.
+	const uint bufferSize = _emulator->opl3Active ? (length << 1) : length;
+	if (bufferSize > _tempBufferSize) {
+		delete[] _tempBuffer;
+		_tempBuffer = new int32[bufferSize];
+		_tempBufferSize = bufferSize;
+	}
 
-			for (uint i = 0; i < readSamples; ++i)
-				buffer[i] = tempBuffer[i];
+	if (_emulator->opl3Active)
+		_emulator->GenerateBlock3(length, _tempBuffer);
+	else
+		_emulator->GenerateBlock2(length, _tempBuffer);
 
-			buffer += readSamples;
-			length -= readSamples;
-		}
-	}
+	for (uint i = 0; i < bufferSize; ++i)
+		buffer[i] = _tempBuffer[i];
 }
 
 } // End of namespace DOSBox
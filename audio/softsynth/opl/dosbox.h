@@ -76,6 +76,10 @@ private:
 
 	DBOPL::Chip *_emulator;
 	Chip _chip[2];
+
+	// Output of the emulator, grown to the largest requested block
+	int32 *_tempBuffer;
+	uint _tempBufferSize;
 	union {
 		uint16 normal;
 		uint8 dual[2];
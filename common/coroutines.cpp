@@ -103,6 +103,9 @@ CoroutineScheduler::CoroutineScheduler() {
 	// diagnostic process counters
 	numProcs = 0;
 	maxProcs = 0;
+	numCycles = 0;
+	numDispatches = 0;
+	numWaitPolls = 0;
 #endif
 
 	pRCfunction = NULL;
@@ -131,9 +134,8 @@ CoroutineScheduler::~CoroutineScheduler() {
 	active = 0;
 
 	// Clear the event list
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i)
-		delete *i;
+	for (EventMap::iterator i = _events.begin(); i != _events.end(); ++i)
+		delete i->_value;
 }
 
 void CoroutineScheduler::reset() {
@@ -166,6 +168,7 @@ void CoroutineScheduler::reset() {
 
 	// no active processes
 	pCurrent = active->pNext = NULL;
+	_activePids.clear();
 
 	// place first process on free list
 	pFreeProcesses = processList;
@@ -181,6 +184,11 @@ void CoroutineScheduler::reset() {
 #ifdef DEBUG
 void CoroutineScheduler::printStats() {
 	debug("%i process of %i used", maxProcs, CORO_NUM_PROCESS);
+
+	if (numCycles) {
+		debug("%u scheduler cycles, %.2f dispatches and %.2f wait polls per cycle",
+		      numCycles, (double)numDispatches / numCycles, (double)numWaitPolls / numCycles);
+	}
 }
 #endif
 
@@ -228,6 +236,9 @@ void CoroutineScheduler::schedule() {
 
 		if (--pProc->sleepTime <= 0) {
 			// process is ready for dispatch, activate it
+#ifdef DEBUG
+			++numDispatches;
+#endif
 			pCurrent = pProc;
 			pProc->coroAddr(pProc->state, pProc->param);
 
@@ -248,13 +259,17 @@ void CoroutineScheduler::schedule() {
 	}
 
 	// Disable any events that were pulsed
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
-		if (evt->pulsing) {
+	for (uint i = 0; i < _pulsedEvents.size(); ++i) {
+		EVENT *evt = getEvent(_pulsedEvents[i]);
+		if (evt && evt->pulsing) {
 			evt->pulsing = evt->signalled = false;
 		}
 	}
+	_pulsedEvents.clear();
+
+#ifdef DEBUG
+	++numCycles;
+#endif
 }
 
 void CoroutineScheduler::rescheduleAll() {
@@ -348,7 +363,6 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 
 	CORO_BEGIN_CONTEXT;
 		uint32 endTime;
-		PROCESS *pProcess;
 		EVENT *pEvent;
 	CORO_END_CONTEXT(_ctx);
 
@@ -364,28 +378,30 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() <= _ctx->endTime) {
-		// Check to see if a process or event with the given Id exists
-		_ctx->pProcess = getProcess(pid);
-		_ctx->pEvent = !_ctx->pProcess ? getEvent(pid) : NULL;
-
-		// If there's no active process or event, presume it's a process that's finished,
-		// so the waiting can immediately exit
-		if ((_ctx->pProcess == NULL) && (_ctx->pEvent == NULL)) {
-			if (expired)
-				*expired = false;
-			break;
-		}
+#ifdef DEBUG
+		++numWaitPolls;
+#endif
+		// If a process with the given Id is still running, keep waiting
+		if (!isProcessActive(pid)) {
+			// If there's no active process or event, presume it's a process that's finished,
+			// so the waiting can immediately exit
+			_ctx->pEvent = getEvent(pid);
+			if (_ctx->pEvent == NULL) {
+				if (expired)
+					*expired = false;
+				break;
+			}
 
-		// If a process was found, don't go into the if statement, and keep waiting.
-		// Likewise if it's an event that's not yet signalled
-		if ((_ctx->pEvent != NULL) && _ctx->pEvent->signalled) {
-			// Unless the event is flagged for manual reset, reset it now
-			if (!_ctx->pEvent->manualReset)
-				_ctx->pEvent->signalled = false;
+			// Likewise if it's an event that's been signalled
+			if (_ctx->pEvent->signalled) {
+				// Unless the event is flagged for manual reset, reset it now
+				if (!_ctx->pEvent->manualReset)
+					_ctx->pEvent->signalled = false;
 
-			if (expired)
-				*expired = false;
-			break;
+				if (expired)
+					*expired = false;
+				break;
+			}
 		}
 
 		// Sleep until the next cycle
@@ -408,7 +424,6 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 		bool signalled;
 		bool pidSignalled;
 		int i;
-		PROCESS *pProcess;
 		EVENT *pEvent;
 	CORO_END_CONTEXT(_ctx);
 
@@ -425,14 +440,16 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() <= _ctx->endTime) {
+#ifdef DEBUG
+		++numWaitPolls;
+#endif
 		_ctx->signalled = bWaitAll;
 
 		for (_ctx->i = 0; _ctx->i < nCount; ++_ctx->i) {
-			_ctx->pProcess = getProcess(pidList[_ctx->i]);
-			_ctx->pEvent = !_ctx->pProcess ? getEvent(pidList[_ctx->i]) : NULL;
+			_ctx->pEvent = !isProcessActive(pidList[_ctx->i]) ? getEvent(pidList[_ctx->i]) : NULL;
 
 			// Determine the signalled state
-			_ctx->pidSignalled = (_ctx->pProcess) || !_ctx->pEvent ? false : _ctx->pEvent->signalled;
+			_ctx->pidSignalled = _ctx->pEvent ? _ctx->pEvent->signalled : false;
 
 			if (bWaitAll && !_ctx->pidSignalled)
 				_ctx->signalled = false;
@@ -446,7 +463,7 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 			for (_ctx->i = 0; _ctx->i < nCount; ++_ctx->i) {
 				_ctx->pEvent = getEvent(pidList[_ctx->i]);
 
-				if (!_ctx->pEvent->manualReset)
+				if (_ctx->pEvent && !_ctx->pEvent->manualReset)
 					_ctx->pEvent->signalled = false;
 			}
 
@@ -539,6 +556,7 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 
 	// set new process id
 	pProc->pid = pid;
+	addActivePid(pid);
 
 	// set new process specific info
 	if (sizeParam) {
@@ -580,6 +598,7 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 
 	delete pKillProc->state;
 	pKillProc->state = 0;
+	removeActivePid(pKillProc->pid);
 
 	// Take the process out of the active chain list
 	pKillProc->pPrevious->pNext = pKillProc->pNext;
@@ -629,6 +648,7 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 
 				delete pProc->state;
 				pProc->state = 0;
+				removeActivePid(pProc->pid);
 
 				// make prev point to next to unlink pProc
 				pPrev->pNext = pProc->pNext;
@@ -663,23 +683,25 @@ void CoroutineScheduler::setResourceCallback(VFPTRPP pFunc) {
 	pRCfunction = pFunc;
 }
 
-PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
-	PROCESS *pProc = active->pNext;
-	while ((pProc != NULL) && (pProc->pid != pid))
-		pProc = pProc->pNext;
+bool CoroutineScheduler::isProcessActive(uint32 pid) const {
+	return _activePids.contains(pid);
+}
 
-	return pProc;
+void CoroutineScheduler::addActivePid(uint32 pid) {
+	_activePids[pid]++;
 }
 
-EVENT *CoroutineScheduler::getEvent(uint32 pid) {
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
-		if (evt->pid == pid)
-			return evt;
-	}
+void CoroutineScheduler::removeActivePid(uint32 pid) {
+	PidCountMap::iterator i = _activePids.find(pid);
+	assert(i != _activePids.end());
 
-	return NULL;
+	if (--i->_value == 0)
+		_activePids.erase(i);
+}
+
+EVENT *CoroutineScheduler::getEvent(uint32 pid) {
+	EventMap::iterator i = _events.find(pid);
+	return (i != _events.end()) ? i->_value : NULL;
 }
 
 
@@ -690,14 +712,14 @@ uint32 CoroutineScheduler::createEvent(bool bManualReset, bool bInitialState) {
 	evt->signalled = bInitialState;
 	evt->pulsing = false;
 
-	_events.push_back(evt);
+	_events[evt->pid] = evt;
 	return evt->pid;
 }
 
 void CoroutineScheduler::closeEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (evt) {
-		_events.remove(evt);
+		_events.erase(pidEvent);
 		delete evt;
 	}
 }
@@ -721,7 +743,10 @@ void CoroutineScheduler::pulseEvent(uint32 pidEvent) {
 
 	// Set the event as signalled and pulsing
 	evt->signalled = true;
-	evt->pulsing = true;
+	if (!evt->pulsing) {
+		evt->pulsing = true;
+		_pulsedEvents.push_back(pidEvent);
+	}
 
 	// If there's an active process, and it's not the first in the queue, then reschedule all
 	// the other prcoesses in the queue to run again this frame
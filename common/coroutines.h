@@ -25,6 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/singleton.h"
 
@@ -359,14 +361,28 @@ private:
 	/** Auto-incrementing process Id */
 	int pidCounter;
 
-	/** Event list */
-	Common::List<EVENT *> _events;
+	typedef Common::HashMap<uint32, EVENT *> EventMap;
+	typedef Common::HashMap<uint32, uint> PidCountMap;
+
+	/** Events, indexed by their Id */
+	EventMap _events;
+
+	/** Ids of the events pulsed during the current scheduler cycle */
+	Common::Array<uint32> _pulsedEvents;
+
+	/** Number of active processes using each process Id */
+	PidCountMap _activePids;
 
 #ifdef DEBUG
 	// diagnostic process counters
 	int numProcs;
 	int maxProcs;
 
+	// diagnostic scheduler counters
+	uint32 numCycles;
+	uint32 numDispatches;
+	uint32 numWaitPolls;
+
 	/**
 	 * Checks both the active and free process list to insure all the links are valid,
 	 * and that no processes have been lost
@@ -380,7 +396,9 @@ private:
 	 */
 	VFPTRPP pRCfunction;
 
-	PROCESS *getProcess(uint32 pid);
+	bool isProcessActive(uint32 pid) const;
+	void addActivePid(uint32 pid);
+	void removeActivePid(uint32 pid);
 	EVENT *getEvent(uint32 pid);
 public:
 	/**
@@ -390,7 +408,8 @@ public:
 
 #ifdef DEBUG
 	/**
-	 * Shows the maximum number of process used at once.
+	 * Shows the maximum number of process used at once, along with
+	 * per-cycle dispatch and wait polling counts.
 	 */
 	void printStats();
 #endif
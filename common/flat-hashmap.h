@@ -0,0 +1,406 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_FLAT_HASHMAP_H
+#define COMMON_FLAT_HASHMAP_H
+
+#include "common/hashmap.h"
+
+#ifdef DEBUG_HASH_COLLISIONS
+#include "common/debug.h"
+#endif
+
+namespace Common {
+
+/**
+ * FlatHashMap<Key,Val> is a drop-in alternative to HashMap<Key,Val> for
+ * small, frequently accessed keys and values.
+ *
+ * Unlike HashMap, which allocates a node per entry and stores pointers to
+ * them, FlatHashMap stores keys and values directly in its table, together
+ * with their hash values. It uses linear probing and moves entries back on
+ * erase, so lookups touch adjacent memory, only call the equality functor
+ * for entries with a matching hash and never have to skip deleted entries.
+ *
+ * Key and Val must be default constructible and assignable.
+ *
+ * @note Any insertion or erase invalidates all iterators and references
+ *       to values in the map. In particular it is not possible to erase
+ *       entries while iterating over the map.
+ */
+template<class Key, class Val, class HashFunc = Hash<Key>, class EqualFunc = EqualTo<Key> >
+class FlatHashMap {
+public:
+	typedef uint size_type;
+
+	struct Node {
+		Key _key;
+		Val _value;
+		Node() : _key(), _value() {}
+	};
+
+private:
+	typedef FlatHashMap<Key, Val, HashFunc, EqualFunc> HM_t;
+
+	enum {
+		HASHMAP_MIN_CAPACITY = 16,
+
+		// The table is grown once it is more than 2/3 full, as in HashMap.
+		HASHMAP_LOADFACTOR_NUMERATOR = 2,
+		HASHMAP_LOADFACTOR_DENOMINATOR = 3
+	};
+
+	struct Entry {
+		size_type _hash;	///< Cached hash value of the key; 0 marks an empty entry
+		Node _node;
+		Entry() : _hash(0), _node() {}
+	};
+
+	Entry *_table;		///< Table of capacity _mask + 1
+	size_type _mask;	///< Capacity of the table minus one; capacity is a power of two
+	size_type _size;
+
+	HashFunc _hash;
+	EqualFunc _equal;
+
+	/** Default value, returned by the const getVal. */
+	const Val _defaultVal;
+
+#ifdef DEBUG_HASH_COLLISIONS
+	mutable int _collisions, _lookups;
+#endif
+
+	size_type hashOf(const Key &key) const {
+		// Many of our hash functions return the key itself or map nearby
+		// keys to nearby values, which leads to long probe sequences with
+		// linear probing. Mix the bits, so the low bits used as the table
+		// index depend on the whole hash value.
+		size_type hash = _hash(key);
+		hash ^= hash >> 16;
+		hash *= 0x85EBCA6B;
+		hash ^= hash >> 13;
+		// 0 is reserved for empty entries
+		return hash ? hash : 1;
+	}
+
+	void allocStorage(size_type capacity) {
+		_mask = capacity - 1;
+		_table = new Entry[capacity];
+	}
+
+	void freeStorage() {
+		delete[] _table;
+	}
+
+	/**
+	 * Return the index of the entry with the given key or, if there is none,
+	 * of the empty entry where it would be inserted.
+	 */
+	size_type lookup(const Key &key, size_type hash) const {
+		size_type ctr = hash & _mask;
+		while (_table[ctr]._hash != 0) {
+			if (_table[ctr]._hash == hash && _equal(_table[ctr]._node._key, key))
+				break;
+			ctr = (ctr + 1) & _mask;
+#ifdef DEBUG_HASH_COLLISIONS
+			_collisions++;
+#endif
+		}
+
+#ifdef DEBUG_HASH_COLLISIONS
+		_lookups++;
+#endif
+		return ctr;
+	}
+
+	size_type lookupAndCreateIfMissing(const Key &key);
+	void expandStorage(size_type newCapacity);
+	void eraseAt(size_type ctr);
+
+	template<class NodeType>
+	class IteratorImpl {
+		friend class FlatHashMap;
+		template<class T> friend class IteratorImpl;
+
+	protected:
+		typedef const FlatHashMap hashmap_t;
+
+		size_type _idx;
+		hashmap_t *_hashmap;
+
+		IteratorImpl(size_type idx, hashmap_t *hashmap) : _idx(idx), _hashmap(hashmap) {}
+
+		NodeType *deref() const {
+			assert(_hashmap != 0);
+			assert(_idx <= _hashmap->_mask);
+			assert(_hashmap->_table[_idx]._hash != 0);
+			return &_hashmap->_table[_idx]._node;
+		}
+
+	public:
+		IteratorImpl() : _idx(0), _hashmap(0) {}
+		template<class T>
+		IteratorImpl(const IteratorImpl<T> &c) : _idx(c._idx), _hashmap(c._hashmap) {}
+
+		NodeType &operator*() const { return *deref(); }
+		NodeType *operator->() const { return deref(); }
+
+		bool operator==(const IteratorImpl &iter) const { return _idx == iter._idx && _hashmap == iter._hashmap; }
+		bool operator!=(const IteratorImpl &iter) const { return !(*this == iter); }
+
+		IteratorImpl &operator++() {
+			assert(_hashmap);
+			do {
+				_idx++;
+			} while (_idx <= _hashmap->_mask && _hashmap->_table[_idx]._hash == 0);
+			if (_idx > _hashmap->_mask)
+				_idx = (size_type)-1;
+
+			return *this;
+		}
+
+		IteratorImpl operator++(int) {
+			IteratorImpl old = *this;
+			operator ++();
+			return old;
+		}
+	};
+
+public:
+	typedef IteratorImpl<Node> iterator;
+	typedef IteratorImpl<const Node> const_iterator;
+
+	FlatHashMap() : _defaultVal() {
+		allocStorage(HASHMAP_MIN_CAPACITY);
+		_size = 0;
+#ifdef DEBUG_HASH_COLLISIONS
+		_collisions = 0;
+		_lookups = 0;
+#endif
+	}
+
+	FlatHashMap(const HM_t &map) : _defaultVal() {
+		allocStorage(map._mask + 1);
+		_size = 0;
+#ifdef DEBUG_HASH_COLLISIONS
+		_collisions = 0;
+		_lookups = 0;
+#endif
+		*this = map;
+	}
+
+	~FlatHashMap() {
+#ifdef DEBUG_HASH_COLLISIONS
+		extern void updateHashCollisionStats(int, int, int, int, int);
+		updateHashCollisionStats(_collisions, 0, _lookups, _mask+1, _size);
+#endif
+		freeStorage();
+	}
+
+	HM_t &operator=(const HM_t &map) {
+		if (this == &map)
+			return *this;
+
+		if (_mask != map._mask) {
+			freeStorage();
+			allocStorage(map._mask + 1);
+		}
+
+		// Entries stay at the same index, since the capacity is the same.
+		for (size_type ctr = 0; ctr <= _mask; ++ctr)
+			_table[ctr] = map._table[ctr];
+		_size = map._size;
+		return *this;
+	}
+
+	bool contains(const Key &key) const {
+		return _table[lookup(key, hashOf(key))]._hash != 0;
+	}
+
+	Val &operator[](const Key &key) { return getVal(key); }
+	const Val &operator[](const Key &key) const { return getVal(key); }
+
+	Val &getVal(const Key &key) {
+		// Insertion may reallocate the table, so look up the entry first.
+		const size_type ctr = lookupAndCreateIfMissing(key);
+		return _table[ctr]._node._value;
+	}
+
+	const Val &getVal(const Key &key) const {
+		return getVal(key, _defaultVal);
+	}
+
+	const Val &getVal(const Key &key, const Val &defaultVal) const {
+		const size_type ctr = lookup(key, hashOf(key));
+		return _table[ctr]._hash ? _table[ctr]._node._value : defaultVal;
+	}
+
+	void setVal(const Key &key, const Val &val) {
+		const size_type ctr = lookupAndCreateIfMissing(key);
+		_table[ctr]._node._value = val;
+	}
+
+	void clear(bool shrinkArray = 0);
+
+	void erase(iterator entry) {
+		assert(entry._hashmap == this);
+		assert(entry._idx <= _mask && _table[entry._idx]._hash != 0);
+		eraseAt(entry._idx);
+	}
+
+	void erase(const Key &key) {
+		const size_type ctr = lookup(key, hashOf(key));
+		if (_table[ctr]._hash)
+			eraseAt(ctr);
+	}
+
+	size_type size() const { return _size; }
+
+	bool empty() const { return _size == 0; }
+
+	iterator begin() {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (_table[ctr]._hash)
+				return iterator(ctr, this);
+		}
+		return end();
+	}
+	iterator end() {
+		return iterator((size_type)-1, this);
+	}
+
+	const_iterator begin() const {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (_table[ctr]._hash)
+				return const_iterator(ctr, this);
+		}
+		return end();
+	}
+	const_iterator end() const {
+		return const_iterator((size_type)-1, this);
+	}
+
+	iterator find(const Key &key) {
+		const size_type ctr = lookup(key, hashOf(key));
+		return _table[ctr]._hash ? iterator(ctr, this) : end();
+	}
+
+	const_iterator find(const Key &key) const {
+		const size_type ctr = lookup(key, hashOf(key));
+		return _table[ctr]._hash ? const_iterator(ctr, this) : end();
+	}
+
+#ifdef DEBUG_HASH_COLLISIONS
+	int getCollisions() const { return _collisions; }
+	int getLookups() const { return _lookups; }
+#endif
+};
+
+//-------------------------------------------------------
+// FlatHashMap functions
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::clear(bool shrinkArray) {
+	if (shrinkArray && _mask >= HASHMAP_MIN_CAPACITY) {
+		freeStorage();
+		allocStorage(HASHMAP_MIN_CAPACITY);
+	} else {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (_table[ctr]._hash)
+				_table[ctr] = Entry();
+		}
+	}
+
+	_size = 0;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity) {
+	assert(newCapacity > _mask + 1);
+
+	const size_type oldMask = _mask;
+	Entry *oldTable = _table;
+
+	allocStorage(newCapacity);
+
+	// Reinsert all entries. The keys are known to be distinct and the
+	// hashes are cached, so neither functor needs to be called.
+	for (size_type ctr = 0; ctr <= oldMask; ++ctr) {
+		const size_type hash = oldTable[ctr]._hash;
+		if (!hash)
+			continue;
+
+		size_type idx = hash & _mask;
+		while (_table[idx]._hash != 0)
+			idx = (idx + 1) & _mask;
+
+		_table[idx]._hash = hash;
+		_table[idx]._node = oldTable[ctr]._node;
+	}
+
+	delete[] oldTable;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookupAndCreateIfMissing(const Key &key) {
+	const size_type hash = hashOf(key);
+	size_type ctr = lookup(key, hash);
+	if (_table[ctr]._hash)
+		return ctr;
+
+	// Keep the load factor below a certain threshold.
+	const size_type capacity = _mask + 1;
+	if ((_size + 1) * HASHMAP_LOADFACTOR_DENOMINATOR > capacity * HASHMAP_LOADFACTOR_NUMERATOR) {
+		expandStorage(capacity < 500 ? (capacity * 4) : (capacity * 2));
+		ctr = lookup(key, hash);
+	}
+
+	_table[ctr]._hash = hash;
+	_table[ctr]._node._key = key;
+	_table[ctr]._node._value = Val();
+	_size++;
+	return ctr;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::eraseAt(size_type ctr) {
+	// Move following entries of the same probe sequence back, so that no
+	// lookup passing the erased entry stops early.
+	size_type next = (ctr + 1) & _mask;
+	while (_table[next]._hash != 0) {
+		const size_type home = _table[next]._hash & _mask;
+		// The entry can be moved to ctr if ctr lies cyclically within
+		// [home, next).
+		if (((next - home) & _mask) >= ((next - ctr) & _mask)) {
+			_table[ctr] = _table[next];
+			ctr = next;
+		}
+		next = (next + 1) & _mask;
+	}
+
+	_table[ctr] = Entry();
+	_size--;
+}
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,89 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/intern-str.h"
+
+namespace Common {
+
+namespace {
+
+struct CString_EqualTo {
+	bool operator()(const char *x, const char *y) const { return !strcmp(x, y); }
+};
+
+} // End of anonymous namespace
+
+// The table is keyed by the string stored in each entry, so the characters
+// are kept only once.
+typedef HashMap<const char *, InternedString *, Hash<const char *>, CString_EqualTo> InternTable;
+
+static InternTable *s_internTable = 0;
+static const InternedString *s_emptyString = 0;
+
+InternedString::InternedString() {
+	if (!s_emptyString)
+		s_emptyString = new InternedString(intern(""));
+	_entry = s_emptyString->_entry;
+}
+
+InternedString::InternedString(const String &str) : _entry(intern(str.c_str())) {
+}
+
+InternedString::InternedString(const char *str) : _entry(intern(str)) {
+}
+
+bool InternedString::find(const char *str, InternedString &result) {
+	if (!s_internTable)
+		return false;
+
+	InternTable::const_iterator i = s_internTable->find(str);
+	if (i == s_internTable->end())
+		return false;
+
+	result = *i->_value;
+	return true;
+}
+
+const InternedString::Entry *InternedString::intern(const char *str) {
+	if (!s_internTable)
+		s_internTable = new InternTable();
+
+	InternTable::const_iterator i = s_internTable->find(str);
+	if (i != s_internTable->end())
+		return i->_value->_entry;
+
+	Entry *entry = new Entry();
+	entry->_str = str;
+	entry->_hash = hashit(str);
+
+	String lower(str);
+	lower.toLowercase();
+	if (lower == entry->_str)
+		entry->_lower = entry;
+	else
+		entry->_lower = intern(lower.c_str());
+
+	s_internTable->setVal(entry->_str.c_str(), new InternedString(entry));
+	return entry;
+}
+
+} // End of namespace Common
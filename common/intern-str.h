@@ -0,0 +1,108 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_INTERN_STR_H
+#define COMMON_INTERN_STR_H
+
+#include "common/hash-str.h"
+
+namespace Common {
+
+/**
+ * An immutable string, which is stored only once no matter how often it is
+ * created ("interned"). Copying, comparing and hashing interned strings
+ * only involves a pointer, and each interned string knows its lowercase
+ * form, so case insensitive comparisons are pointer comparisons, too.
+ *
+ * This makes InternedString a good key for maps which are looked up often,
+ * e.g. by file or identifier names. Creating an InternedString from a
+ * String still costs a lookup in the global string table, so the benefit
+ * comes from creating it once and using it many times.
+ *
+ * Interned strings are never freed. Interning is not thread safe.
+ */
+class InternedString {
+public:
+	/** Create an empty string. */
+	InternedString();
+
+	explicit InternedString(const String &str);
+	explicit InternedString(const char *str);
+
+	/**
+	 * Look up a string which has already been interned, without interning
+	 * it otherwise.
+	 *
+	 * @return true if str has been interned before, false otherwise
+	 */
+	static bool find(const char *str, InternedString &result);
+
+	const String &toString() const { return _entry->_str; }
+	const char *c_str() const { return _entry->_str.c_str(); }
+	uint size() const { return _entry->_str.size(); }
+	bool empty() const { return _entry->_str.empty(); }
+
+	/** Return the case sensitive hash value, see hashit(). */
+	uint hash() const { return _entry->_hash; }
+
+	/** Return the case insensitive hash value, see hashit_lower(). */
+	uint hashIgnoreCase() const { return _entry->_lower->_hash; }
+
+	InternedString toLowercase() const { return InternedString(_entry->_lower); }
+
+	bool operator==(const InternedString &x) const { return _entry == x._entry; }
+	bool operator!=(const InternedString &x) const { return _entry != x._entry; }
+
+	bool equalsIgnoreCase(const InternedString &x) const { return _entry->_lower == x._entry->_lower; }
+
+private:
+	struct Entry {
+		String _str;
+		uint _hash;
+		const Entry *_lower;	///< Entry of the lowercase form; may be this entry
+	};
+
+	const Entry *_entry;
+
+	explicit InternedString(const Entry *entry) : _entry(entry) {}
+
+	static const Entry *intern(const char *str);
+};
+
+template<>
+struct Hash<InternedString> {
+	uint operator()(const InternedString &s) const {
+		return s.hash();
+	}
+};
+
+struct InternedStringIgnoreCase_EqualTo {
+	bool operator()(const InternedString &x, const InternedString &y) const { return x.equalsIgnoreCase(y); }
+};
+
+struct InternedStringIgnoreCase_Hash {
+	uint operator()(const InternedString &x) const { return x.hashIgnoreCase(); }
+};
+
+} // End of namespace Common
+
+#endif
@@ -39,6 +39,41 @@ SeekableReadStream *ReadStream::readStream(uint32 dataSize) {
 	return new MemoryReadStream((byte *)buf, dataSize, DisposeAfterUse::YES);
 }
 
+// The conversion loops compile to nothing if the data is already in the
+// native byte order. Elements missing after a short read are zeroed.
+
+uint32 ReadStream::readUint16LEArray(uint16 *dst, uint32 count) {
+	uint32 done = read(dst, count * 2) / 2;
+	for (uint32 i = 0; i < done; ++i)
+		dst[i] = FROM_LE_16(dst[i]);
+	memset(dst + done, 0, (count - done) * 2);
+	return done;
+}
+
+uint32 ReadStream::readUint16BEArray(uint16 *dst, uint32 count) {
+	uint32 done = read(dst, count * 2) / 2;
+	for (uint32 i = 0; i < done; ++i)
+		dst[i] = FROM_BE_16(dst[i]);
+	memset(dst + done, 0, (count - done) * 2);
+	return done;
+}
+
+uint32 ReadStream::readUint32LEArray(uint32 *dst, uint32 count) {
+	uint32 done = read(dst, count * 4) / 4;
+	for (uint32 i = 0; i < done; ++i)
+		dst[i] = FROM_LE_32(dst[i]);
+	memset(dst + done, 0, (count - done) * 4);
+	return done;
+}
+
+uint32 ReadStream::readUint32BEArray(uint32 *dst, uint32 count) {
+	uint32 done = read(dst, count * 4) / 4;
+	for (uint32 i = 0; i < done; ++i)
+		dst[i] = FROM_BE_32(dst[i]);
+	memset(dst + done, 0, (count - done) * 4);
+	return done;
+}
+
 
 uint32 MemoryReadStream::read(void *dataPtr, uint32 dataSize) {
 	// Read at most as many bytes as are still available...
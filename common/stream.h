@@ -311,6 +311,33 @@ public:
 		return (int32)readUint32BE();
 	}
 
+	/**
+	 * Read an array of unsigned 16-bit words stored in little endian
+	 * (LSB first) order from the stream, with a single call to read().
+	 * Returns the number of complete words read, which might be less than
+	 * requested if an error occurred or the end of the stream was reached.
+	 * The remaining words of dst are set to 0 in that case.
+	 */
+	uint32 readUint16LEArray(uint16 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 16-bit words stored in big endian
+	 * (MSB first) order from the stream. See readUint16LEArray().
+	 */
+	uint32 readUint16BEArray(uint16 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 32-bit words stored in little endian
+	 * (LSB first) order from the stream. See readUint16LEArray().
+	 */
+	uint32 readUint32LEArray(uint32 *dst, uint32 count);
+
+	/**
+	 * Read an array of unsigned 32-bit words stored in big endian
+	 * (MSB first) order from the stream. See readUint16LEArray().
+	 */
+	uint32 readUint32BEArray(uint32 *dst, uint32 count);
+
 	/**
 	 * Read the specified amount of data into a malloc'ed buffer
 	 * which then is wrapped into a MemoryReadStream.
@@ -1462,17 +1462,27 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		&Screen::drawShapeSkipScaleDownwind
 	};
 
-	static const DsLineFunc dsLineFunc[] = {
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind
+#define DS_LINE_FUNCS(plot) \
+	{ \
+		&Screen::drawShapeProcessLineNoScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<plot>, \
+		&Screen::drawShapeProcessLineNoScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<plot>, \
+		&Screen::drawShapeProcessLineScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineScaleDownwind<plot>, \
+		&Screen::drawShapeProcessLineScaleUpwind<plot>, \
+		&Screen::drawShapeProcessLineScaleDownwind<plot> \
+	}
+
+	static const DsLineFunc dsLineFunc[][8] = {
+		DS_LINE_FUNCS(&Screen::drawShapePlotDynamic),
+		DS_LINE_FUNCS(&Screen::drawShapePlotType0),
+		DS_LINE_FUNCS(&Screen::drawShapePlotType1),
+		DS_LINE_FUNCS(&Screen::drawShapePlotType4)
 	};
 
+#undef DS_LINE_FUNCS
+
 	static const DsPlotFunc dsPlotFunc[] = {
 		&Screen::drawShapePlotType0,		// used by Kyra 1 + 2
 		&Screen::drawShapePlotType1,		// used by Kyra 3
@@ -1512,7 +1522,6 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 	const int drawFunc = flags & 0x0F;
 	_dsProcessMargin = dsMarginFunc[drawFunc];
 	_dsScaleSkip = dsSkipFunc[drawFunc];
-	_dsProcessLine = dsLineFunc[drawFunc];
 
 	const int ppc = (flags >> 8) & 0x3F;
 	_dsPlot = dsPlotFunc[ppc];
@@ -1520,6 +1529,19 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 	if (flags & 0x800)
 		dsPlot3 = dsPlotFunc[((flags >> 8) & 0xF7) & 0x3F];
 
+	// Use a line function with the plotting method inlined, unless the
+	// method changes from line to line or has no specialisation
+	int lineFuncSet = 0;
+	if (dsPlot2 == dsPlot3) {
+		if (ppc == 0)
+			lineFuncSet = 1;
+		else if (ppc == 1)
+			lineFuncSet = 2;
+		else if (ppc == 4)
+			lineFuncSet = 3;
+	}
+	_dsProcessLine = dsLineFunc[lineFuncSet][drawFunc];
+
 	if (!_dsPlot || !dsPlot2 || !dsPlot3) {
 		if (!dsPlot2)
 			warning("Missing drawShape plotting method type %d", ppc);
@@ -1835,12 +1857,13 @@ int Screen::drawShapeSkipScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt)
 	return found ? 0 : _dsOffscreenScaleVal1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst++;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1850,12 +1873,13 @@ void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, i
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst--;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1865,6 +1889,7 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1884,7 +1909,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 				scaleState = r & 0xFF;
 			}
 		} else if (scaleState) {
-			(this->*_dsPlot)(dst++, c);
+			(this->*plot)(dst++, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -1893,6 +1918,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 	cnt = -1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1912,7 +1938,7 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 				scaleState = r & 0xFF;
 			}
 		} else {
-			(this->*_dsPlot)(dst--, c);
+			(this->*plot)(dst--, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -1921,6 +1947,10 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 	cnt = -1;
 }
 
+void Screen::drawShapePlotDynamic(uint8 *dst, uint8 cmd) {
+	(this->*_dsPlot)(dst, cmd);
+}
+
 void Screen::drawShapePlotType0(uint8 *dst, uint8 cmd) {
 	*dst = cmd;
 }
@@ -217,11 +217,40 @@ void MohawkBitmap::unpackRaw() {
 #define CBUFFERSIZE		(1 << POS_BITS)						// size of the circular buffer
 #define POS_MASK		(CBUFFERSIZE - 1)
 
+// Reads the rest of a packed stream into a single buffer, followed by
+// padding zero bytes so that decoders can run slightly past the end of
+// corrupted data, as reading past the end of the stream used to do.
+static byte *readPackedData(Common::SeekableReadStream *stream, uint32 padding, uint32 &size) {
+	size = stream->size() - stream->pos();
+
+	byte *data = (byte *)malloc(size + padding);
+	size = stream->read(data, size);
+	memset(data + size, 0, padding);
+
+	return data;
+}
+
+// Copies a back reference, which repeats a pattern when it overlaps the
+// bytes being written
+static inline void copyBackReference(byte *dst, const byte *src, uint16 length) {
+	if (src < dst && dst - src < length) {
+		for (uint16 i = 0; i < length; i++)
+			dst[i] = src[i];
+	} else {
+		memmove(dst, src, length);
+	}
+}
+
 Common::SeekableReadStream *MohawkBitmap::decompressLZ(Common::SeekableReadStream *stream, uint32 uncompressedSize) {
 	uint16 flags = 0;
 	uint32 bytesOut = 0;
 	uint16 insertPos = 0;
 
+	uint32 inputSize;
+	byte *inputData = readPackedData(stream, 2, inputSize);
+	const byte *src = inputData;
+	const byte *srcEnd = inputData + inputSize;
+
 	// Expand the output buffer to at least the ring buffer size
 	uint32 outBufSize = MAX<int>(uncompressedSize, CBUFFERSIZE);
 
@@ -232,22 +261,23 @@ Common::SeekableReadStream *MohawkBitmap::decompressLZ(Common::SeekableReadStrea
 	// Clear the buffer to all 0's
 	memset(outputData, 0, outBufSize);
 
-	while (stream->pos() < stream->size()) {
+	while (src < srcEnd) {
 		flags >>= 1;
 
 		if (!(flags & 0x100))
-			flags = stream->readByte() | 0xff00;
+			flags = *src++ | 0xff00;
 
 		if (flags & 1) {
 			if (++bytesOut > uncompressedSize)
 				break;
-			*dst++ = stream->readByte();
+			*dst++ = *src++;
 			if (++insertPos > POS_MASK) {
 				insertPos = 0;
 				buf += CBUFFERSIZE;
 			}
 		} else {
-			uint16 offLen = stream->readUint16BE();
+			uint16 offLen = READ_BE_UINT16(src);
+			src += 2;
 			uint16 stringLen = (offLen >> POS_BITS) + MIN_STRING;
 			uint16 stringPos = (offLen + MAX_STRING) & POS_MASK;
 
@@ -281,14 +311,16 @@ Common::SeekableReadStream *MohawkBitmap::decompressLZ(Common::SeekableReadStrea
 				buf += CBUFFERSIZE;
 			}
 
-			for (uint16 k = 0; k < stringLen; k++)
-				*dst++ = *strPtr++;
+			copyBackReference(dst, strPtr, stringLen);
+			dst += stringLen;
 
 			if (bytesOut >= uncompressedSize)
 				break;
 		}
 	}
 
+	free(inputData);
+
 	return new Common::MemoryReadStream(outputData, uncompressedSize, DisposeAfterUse::YES);
 }
 
@@ -314,20 +346,26 @@ void MohawkBitmap::unpackLZ() {
 void MohawkBitmap::unpackRiven() {
 	_data->readUint32BE(); // Unknown, the number is close to bytesPerRow * height. Could be bufSize.
 
+	// A single command reads at most 63 subcommands of up to 3 bytes each,
+	// so this much padding covers a command running past the end of the data
+	uint32 packedSize;
+	byte *packedData = readPackedData(_data, 256, packedSize);
+	const byte *src = packedData;
+	const byte *srcEnd = packedData + packedSize;
+
 	byte *uncompressedData = (byte *)malloc(_header.bytesPerRow * _header.height);
 	byte *dst = uncompressedData;
 
-	while (!_data->eos() && dst < (uncompressedData + _header.bytesPerRow * _header.height)) {
-		byte cmd = _data->readByte();
+	while (src < srcEnd && dst < (uncompressedData + _header.bytesPerRow * _header.height)) {
+		byte cmd = *src++;
 		debug (8, "Riven Pack Command %02x", cmd);
 
 		if (cmd == 0x00) {                       // End of stream
 			break;
 		} else if (cmd >= 0x01 && cmd <= 0x3f) { // Simple Pixel Duplet Output
-			for (byte i = 0; i < cmd; i++) {
-				*dst++ = _data->readByte();
-				*dst++ = _data->readByte();
-			}
+			memcpy(dst, src, cmd * 2);
+			dst += cmd * 2;
+			src += cmd * 2;
 		} else if (cmd >= 0x40 && cmd <= 0x7f) { // Simple Repetition of last 2 pixels (cmd - 0x40) times
 			byte pixel[] = { *(dst - 2), *(dst - 1) };
 
@@ -345,10 +383,11 @@ void MohawkBitmap::unpackRiven() {
 				*dst++ = pixel[3];
 			}
 		} else {                                 // Subcommand Stream of (cmd - 0xc0) subcommands
-			handleRivenSubcommandStream(cmd - 0xc0, dst);
+			handleRivenSubcommandStream(cmd - 0xc0, dst, src);
 		}
 	}
 
+	free(packedData);
 	delete _data;
 	_data = new Common::MemoryReadStream(uncompressedData, _header.bytesPerRow * _header.height, DisposeAfterUse::YES);
 }
@@ -366,7 +405,7 @@ static byte getLastFourBits(byte c) {
 }
 
 #define B_BYTE()				\
-	*dst = _data->readByte();	\
+	*dst = *src++;				\
 	dst++
 
 #define B_LASTDUPLET()			\
@@ -394,18 +433,16 @@ static byte getLastFourBits(byte c) {
 	dst++
 
 #define B_NDUPLETS(n)													\
-	uint16 m1 = ((getLastTwoBits(cmd) << 8) + _data->readByte());		\
-		for (uint16 j = 0; j < (n); j++) {								\
-			*dst = *(dst - m1);											\
-			dst++;														\
-		}																\
+	uint16 m1 = ((getLastTwoBits(cmd) << 8) + *src++);					\
+		copyBackReference(dst, dst - m1, (n));							\
+		dst += (n);														\
 		void dummyFuncToAllowTrailingSemicolon()
 
 
 
-void MohawkBitmap::handleRivenSubcommandStream(byte count, byte *&dst) {
+void MohawkBitmap::handleRivenSubcommandStream(byte count, byte *&dst, const byte *&src) {
 	for (byte i = 0; i < count; i++) {
-		byte cmd = _data->readByte();
+		byte cmd = *src++;
 		uint16 m = getLastFourBits(cmd);
 		debug (9, "Riven Pack Subcommand %02x", cmd);
 
@@ -473,13 +510,13 @@ void MohawkBitmap::handleRivenSubcommandStream(byte count, byte *&dst) {
 		} else if (cmd == 0xa0) {
 			// Repeat last duplet, adding first 4 bits of the next byte
 			// to first pixel and last 4 bits to second
-			byte pattern = _data->readByte();
+			byte pattern = *src++;
 			B_LASTDUPLET_PLUS(pattern >> 4);
 			B_LASTDUPLET_PLUS(getLastFourBits(pattern));
 		} else if (cmd == 0xb0) {
 			// Repeat last duplet, adding first 4 bits of the next byte
 			// to first pixel and subtracting last 4 bits from second
-			byte pattern = _data->readByte();
+			byte pattern = *src++;
 			B_LASTDUPLET_PLUS(pattern >> 4);
 			B_LASTDUPLET_MINUS(getLastFourBits(pattern));
 		} else if (cmd >= 0xc0 && cmd <= 0xcf) {
@@ -493,13 +530,13 @@ void MohawkBitmap::handleRivenSubcommandStream(byte count, byte *&dst) {
 		} else if (cmd == 0xe0) {
 			// Repeat last duplet, subtracting first 4 bits of the next byte
 			// to first pixel and adding last 4 bits to second
-			byte pattern = _data->readByte();
+			byte pattern = *src++;
 			B_LASTDUPLET_MINUS(pattern >> 4);
 			B_LASTDUPLET_PLUS(getLastFourBits(pattern));
 		} else if (cmd == 0xf0 || cmd == 0xff) {
 			// Repeat last duplet, subtracting first 4 bits from the next byte
 			// to first pixel and last 4 bits from second
-			byte pattern = _data->readByte();
+			byte pattern = *src++;
 			B_LASTDUPLET_MINUS(pattern >> 4);
 			B_LASTDUPLET_MINUS(getLastFourBits(pattern));
 
@@ -535,8 +572,8 @@ void MohawkBitmap::handleRivenSubcommandStream(byte count, byte *&dst) {
 			B_NDUPLETS(13);
 			B_BYTE();
 		} else if (cmd == 0xfc) {
-			byte b1 = _data->readByte();
-			byte b2 = _data->readByte();
+			byte b1 = *src++;
+			byte b2 = *src++;
 			uint16 m1 = ((getLastTwoBits(b1) << 8) + b2);
 
 			for (uint16 j = 0; j < ((b1 >> 3) + 1); j++) { // one less iteration
@@ -68,7 +68,7 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() : _cacheSize(0), _cacheUseCounter(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -76,8 +76,8 @@ GraphicsManager::~GraphicsManager() {
 }
 
 void GraphicsManager::clearCache() {
-	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++)
-		delete it->_value;
+	for (ImageCache::iterator it = _cache.begin(); it != _cache.end(); it++)
+		delete it->_value.surface;
 	for (Common::HashMap<uint16, Common::Array<MohawkSurface *> >::iterator it = _subImageCache.begin(); it != _subImageCache.end(); it++) {
 		Common::Array<MohawkSurface *> &array = it->_value;
 		for (uint i = 0; i < array.size(); i++)
@@ -86,18 +86,52 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheSize = 0;
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
-	if (!_cache.contains(id))
-		_cache[id] = decodeImage(id);
+	ImageCache::iterator it = _cache.find(id);
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	if (it == _cache.end()) {
+		insertCachedImage(id, decodeImage(id), false);
+		it = _cache.find(id);
+	}
+
+	it->_value.lastUse = ++_cacheUseCounter;
+	return it->_value.surface;
+}
 
-	return _cache[id];
+void GraphicsManager::insertCachedImage(uint16 id, MohawkSurface *surface, bool pinned) {
+	Graphics::Surface *s = surface->getSurface();
+
+	CachedImage &entry = _cache[id];
+	entry.surface = surface;
+	entry.size = s ? s->pitch * s->h : 0;
+	entry.lastUse = ++_cacheUseCounter;
+	entry.pinned = pinned;
+
+	_cacheSize += entry.size;
+	pruneCache(id);
+}
+
+void GraphicsManager::pruneCache(uint16 keepId) {
+	while (_cacheSize > kImageCacheBudget) {
+		// Find the least recently used image that may be evicted
+		ImageCache::iterator oldest = _cache.end();
+		for (ImageCache::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (it->_key == keepId || it->_value.pinned)
+				continue;
+			if (oldest == _cache.end() || it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+		}
+
+		if (oldest == _cache.end())
+			break;
+
+		_cacheSize -= oldest->_value.size;
+		delete oldest->_value.surface;
+		_cache.erase(oldest);
+	}
 }
 
 Common::Array<MohawkSurface *> GraphicsManager::decodeImages(uint16 id) {
@@ -227,7 +261,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 	if (_cache.contains(id))
 		error("Image %d already in cache", id);
 
-	_cache[id] = surface;
+	insertCachedImage(id, surface, true);
 }
 
 } // End of namespace Mohawk
@@ -87,6 +87,8 @@ protected:
 
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
+	// The returned surface stays valid until the next findImage() call
+	// that has to decode an image, as that may evict older images.
 	MohawkSurface *findImage(uint16 id);
 
 	// decodeImage will always return a new image.
@@ -94,11 +96,31 @@ protected:
 	virtual Common::Array<MohawkSurface *> decodeImages(uint16 id);
 
 	virtual MohawkEngine *getVM() = 0;
+	// Adds an image that is kept in the cache until clearCache() is called
 	void addImageToCache(uint16 id, MohawkSurface *surface);
 
 private:
-	// An image cache that stores images until clearCache() is called
-	Common::HashMap<uint16, MohawkSurface *> _cache;
+	// Size in bytes above which the least recently used images are evicted
+	enum {
+		kImageCacheBudget = 16 * 1024 * 1024
+	};
+
+	struct CachedImage {
+		MohawkSurface *surface;
+		uint32 size;
+		uint32 lastUse;
+		bool pinned;
+	};
+
+	void insertCachedImage(uint16 id, MohawkSurface *surface, bool pinned);
+	void pruneCache(uint16 keepId);
+
+	// An image cache that stores recently used images until it outgrows its
+	// budget or clearCache() is called
+	typedef Common::HashMap<uint16, CachedImage> ImageCache;
+	ImageCache _cache;
+	uint32 _cacheSize;
+	uint32 _cacheUseCounter;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
 };
 
@@ -565,9 +565,9 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 
 	unloadCard();
 
-	// Clear the resource cache and image cache
+	// Clear the resource cache. The image cache is kept, as images
+	// are often shared by neighbouring cards of the same stack.
 	_cache.clear();
-	_gfx->clearCache();
 
 	_curCard = card;
 
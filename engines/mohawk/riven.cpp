@@ -365,10 +365,6 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	_curCard = dest;
 	debug (1, "Changing to card %d", _curCard);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
-
 	if (!(getFeatures() & GF_DEMO)) {
 		for (byte i = 0; i < 13; i++)
 			if (_curStack == rivenSpecialChange[i].startStack && _curCard == matchRMAPToCard(rivenSpecialChange[i].startCardRMAP)) {
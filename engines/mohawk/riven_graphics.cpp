@@ -69,11 +69,14 @@ void RivenGraphics::copyImageToScreen(uint16 image, uint32 left, uint32 top, uin
 	Graphics::Surface *surface = findImage(image)->getSurface();
 
 	// Clip the width to fit on the screen. Fixes some images.
-	if (left + surface->w > 608)
-		surface->w = 608 - left;
+	// The cached surface itself is left untouched, as it may be drawn
+	// elsewhere on another card.
+	uint16 width = surface->w;
+	if (left + width > 608)
+		width = 608 - left;
 
 	for (uint16 i = 0; i < surface->h; i++)
-		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), surface->w * surface->format.bytesPerPixel);
+		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), width * surface->format.bytesPerPixel);
 
 	_dirtyScreen = true;
 }
@@ -148,11 +151,30 @@ void RivenGraphics::scheduleWaterEffect(uint16 sfxeID) {
 	uint32 *frameOffsets = new uint32[sfxeRecord.frameCount];
 	for (uint16 i = 0; i < sfxeRecord.frameCount; i++)
 		frameOffsets[i] = sfxeStream->readUint32BE();
-	sfxeStream->seek(frameOffsets[0]);
 
-	// Read in the scripts
-	for (uint16 i = 0; i < sfxeRecord.frameCount; i++)
-		sfxeRecord.frameScripts.push_back(sfxeStream->readStream((i == sfxeRecord.frameCount - 1) ? sfxeStream->size() - frameOffsets[i] : frameOffsets[i + 1] - frameOffsets[i]));
+	// Decode the scripts up front, so running a frame is only a series of row copies
+	for (uint16 i = 0; i < sfxeRecord.frameCount; i++) {
+		sfxeStream->seek(frameOffsets[i]);
+		sfxeRecord.frameStarts.push_back(sfxeRecord.copies.size());
+
+		uint16 curRow = 0;
+		for (uint16 op = sfxeStream->readUint16BE(); op != 4; op = sfxeStream->readUint16BE()) {
+			if (op == 1) {        // Increment Row
+				curRow++;
+			} else if (op == 3) { // Copy Pixels
+				SFXECopy copy;
+				copy.dstLeft = sfxeStream->readUint16BE();
+				copy.dstTop = curRow + sfxeRecord.rect.top;
+				copy.srcLeft = sfxeStream->readUint16BE();
+				copy.srcTop = sfxeStream->readUint16BE();
+				copy.width = sfxeStream->readUint16BE();
+				sfxeRecord.copies.push_back(copy);
+			} else {              // End of Script
+				error ("Unknown SFXE opcode %d", op);
+			}
+		}
+	}
+	sfxeRecord.frameStarts.push_back(sfxeRecord.copies.size());
 
 	// Set it to the first frame
 	sfxeRecord.curFrame = 0;
@@ -180,25 +202,11 @@ bool RivenGraphics::runScheduledWaterEffects() {
 			if (!screen)
 				screen = _vm->_system->lockScreen();
 
-			// Make sure the script is at the starting point
-			Common::SeekableReadStream *script = _waterEffects[i].frameScripts[_waterEffects[i].curFrame];
-			if (script->pos() != 0)
-				script->seek(0);
-
-			// Run script
-			uint16 curRow = 0;
-			for (uint16 op = script->readUint16BE(); op != 4; op = script->readUint16BE()) {
-				if (op == 1) {        // Increment Row
-					curRow++;
-				} else if (op == 3) { // Copy Pixels
-					uint16 dstLeft = script->readUint16BE();
-					uint16 srcLeft = script->readUint16BE();
-					uint16 srcTop = script->readUint16BE();
-					uint16 rowWidth = script->readUint16BE();
-					memcpy ((byte *)screen->getBasePtr(dstLeft, curRow + _waterEffects[i].rect.top), (byte *)_mainScreen->getBasePtr(srcLeft, srcTop), rowWidth * _pixelFormat.bytesPerPixel);
-				} else if (op != 4) { // End of Script
-					error ("Unknown SFXE opcode %d", op);
-				}
+			// Run the frame's row copies
+			const SFXERecord &effect = _waterEffects[i];
+			for (uint32 j = effect.frameStarts[effect.curFrame]; j < effect.frameStarts[effect.curFrame + 1]; j++) {
+				const SFXECopy &copy = effect.copies[j];
+				memcpy(screen->getBasePtr(copy.dstLeft, copy.dstTop), _mainScreen->getBasePtr(copy.srcLeft, copy.srcTop), copy.width * _pixelFormat.bytesPerPixel);
 			}
 
 			// Increment frame
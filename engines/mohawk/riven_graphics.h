@@ -72,12 +72,24 @@ private:
 	MohawkBitmap *_bitmapDecoder;
 
 	// Water Effects
+	struct SFXECopy {
+		uint16 dstLeft;
+		uint16 dstTop;
+		uint16 srcLeft;
+		uint16 srcTop;
+		uint16 width;
+	};
+
 	struct SFXERecord {
 		// Record values
 		uint16 frameCount;
 		Common::Rect rect;
 		uint16 speed;
-		Common::Array<Common::SeekableReadStream *> frameScripts;
+
+		// The frame scripts, decoded into row copies. The copies of frame
+		// i are copies[frameStarts[i]] up to copies[frameStarts[i + 1]].
+		Common::Array<SFXECopy> copies;
+		Common::Array<uint32> frameStarts;
 
 		// Cur frame
 		uint16 curFrame;
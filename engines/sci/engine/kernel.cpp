@@ -65,17 +65,27 @@ const Common::String &Kernel::getSelectorName(uint selector) {
 		// This should only occur in games w/o a selector-table
 		//  We need this for proper workaround tables
 		// TODO: maybe check, if there is a fixed selector-table and error() out in that case
-		for (uint loopSelector = _selectorNames.size(); loopSelector <= selector; ++loopSelector)
+		for (uint loopSelector = _selectorNames.size(); loopSelector <= selector; ++loopSelector) {
 			_selectorNames.push_back(Common::String::format("<noname%d>", loopSelector));
+			mapSelectorName(loopSelector);
+		}
 	}
 
 	// Ensure that the selector has a name
-	if (_selectorNames[selector].empty())
+	if (_selectorNames[selector].empty()) {
 		_selectorNames[selector] = Common::String::format("<noname%d>", selector);
+		mapSelectorName(selector);
+	}
 
 	return _selectorNames[selector];
 }
 
+void Kernel::mapSelectorName(uint selector) {
+	const Common::InternedString name(_selectorNames[selector]);
+	if (!_selectorMap.contains(name))
+		_selectorMap[name] = selector;
+}
+
 uint Kernel::getKernelNamesSize() const {
 	return _kernelNames.size();
 }
@@ -97,9 +107,13 @@ int Kernel::findKernelFuncPos(Common::String kernelFuncName) {
 }
 
 int Kernel::findSelector(const char *selectorName) const {
-	for (uint pos = 0; pos < _selectorNames.size(); ++pos) {
-		if (_selectorNames[pos] == selectorName)
-			return pos;
+	// All selector names are interned, so a name which is not interned
+	// cannot be a selector.
+	Common::InternedString name;
+	if (Common::InternedString::find(selectorName, name)) {
+		Common::HashMap<Common::InternedString, int>::const_iterator i = _selectorMap.find(name);
+		if (i != _selectorMap.end())
+			return i->_value;
 	}
 
 	debugC(kDebugLevelVM, "Could not map '%s' to any selector", selectorName);
@@ -133,6 +147,7 @@ void Kernel::loadSelectorNames() {
 
 		for (uint32 i = 0; i < staticSelectorTable.size(); i++) {
 			_selectorNames.push_back(staticSelectorTable[i]);
+			mapSelectorName(_selectorNames.size() - 1);
 			if (oldScriptHeader)
 				_selectorNames.push_back(staticSelectorTable[i]);
 		}
@@ -148,6 +163,7 @@ void Kernel::loadSelectorNames() {
 
 		Common::String tmp((const char *)r->data + offset + 2, len);
 		_selectorNames.push_back(tmp);
+		mapSelectorName(_selectorNames.size() - 1);
 		//debug("%s", tmp.c_str());
 
 		// Early SCI versions used the LSB in the selector ID as a read/write
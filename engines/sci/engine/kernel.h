@@ -25,6 +25,7 @@
 
 #include "common/scummsys.h"
 #include "common/debug.h"
+#include "common/intern-str.h"
 #include "common/rect.h"
 #include "common/str-array.h"
 
@@ -256,8 +257,16 @@ private:
 	ResourceManager *_resMan;
 	SegManager *_segMan;
 
+	/**
+	 * Adds the name of the selector with the given number to the selector
+	 * map, unless a selector with a lower number has the same name.
+	 */
+	void mapSelectorName(uint selector);
+
 	// Kernel-related lists
 	Common::StringArray _selectorNames;
+	/** Maps selector names to their numbers, used by findSelector(). */
+	Common::HashMap<Common::InternedString, int> _selectorMap;
 	Common::StringArray _kernelNames;
 
 	const Common::String _invalid;
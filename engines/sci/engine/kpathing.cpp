@@ -111,21 +111,117 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* bookkeeping: position in the open set heap (-1 if not in the open
+	// set), order of insertion into the open set and closed set membership
+	int heapIndex;
+	uint openOrder;
+	bool closed;
+
+	// Index into the cached visibility graph, or -1 if the vertex is not
+	// part of it (newly added start and end points)
+	int visIndex;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		heapIndex = -1;
+		openOrder = 0;
+		closed = false;
+		visIndex = -1;
 	}
 };
 
-class VertexList: public Common::List<Vertex *> {
+typedef Common::List<Vertex *> VertexList;
+
+/**
+ * Open set of the A* search, kept as a binary heap on the F cost. Ties are
+ * broken in favor of the vertex that was added to the open set last, which
+ * is the order in which the former list-based open set picked vertices.
+ */
+class VertexHeap {
 public:
-	bool contains(Vertex *v) {
-		for (iterator it = begin(); it != end(); ++it) {
-			if (v == *it)
-				return true;
+	VertexHeap() : _counter(0) {}
+
+	bool empty() const {
+		return _heap.empty();
+	}
+
+	Vertex *top() const {
+		return _heap[0];
+	}
+
+	void push(Vertex *vertex) {
+		vertex->openOrder = _counter++;
+		vertex->heapIndex = _heap.size();
+		_heap.push_back(vertex);
+		siftUp(vertex->heapIndex);
+	}
+
+	void pop() {
+		Vertex *last = _heap.back();
+		_heap[0]->heapIndex = -1;
+		_heap.pop_back();
+
+		if (!_heap.empty()) {
+			_heap[0] = last;
+			last->heapIndex = 0;
+			siftDown(0);
 		}
-		return false;
+	}
+
+	/**
+	 * Restores the heap order after the F cost of a vertex in the open set
+	 * has decreased.
+	 */
+	void decreased(Vertex *vertex) {
+		siftUp(vertex->heapIndex);
+	}
+
+private:
+	Common::Array<Vertex *> _heap;
+	uint _counter;
+
+	static bool before(const Vertex *a, const Vertex *b) {
+		if (a->costF != b->costF)
+			return a->costF < b->costF;
+		return a->openOrder > b->openOrder;
+	}
+
+	void place(uint index, Vertex *vertex) {
+		_heap[index] = vertex;
+		vertex->heapIndex = index;
+	}
+
+	void siftUp(uint index) {
+		Vertex *vertex = _heap[index];
+
+		while (index > 0) {
+			uint parent = (index - 1) / 2;
+			if (!before(vertex, _heap[parent]))
+				break;
+			place(index, _heap[parent]);
+			index = parent;
+		}
+
+		place(index, vertex);
+	}
+
+	void siftDown(uint index) {
+		Vertex *vertex = _heap[index];
+		uint size = _heap.size();
+
+		while (2 * index + 1 < size) {
+			uint child = 2 * index + 1;
+			if (child + 1 < size && before(_heap[child + 1], _heap[child]))
+				child++;
+			if (!before(_heap[child], vertex))
+				break;
+			place(index, _heap[child]);
+			index = child;
+		}
+
+		place(index, vertex);
 	}
 };
 
@@ -236,6 +332,16 @@ public:
 
 typedef Common::List<Polygon *> PolygonList;
 
+// Maximum number of polygon sets for which the visibility graph is cached
+#define AVOIDPATH_MAX_CACHED_SETS 4
+
+// Visibility graph entries
+enum {
+	VIS_UNKNOWN = 0,
+	VIS_VISIBLE = 1,
+	VIS_HIDDEN = 2
+};
+
 // Pathfinding state
 struct PathfindingState {
 	// List of all polygons
@@ -257,12 +363,17 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Cached visibility graph of the polygon vertices, or NULL if the
+	// polygon set doesn't match it
+	AvoidPathVisibility *_visibility;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = NULL;
 		vertex_end = NULL;
 		vertex_index = NULL;
 		_prependPoint = NULL;
 		_appendPoint = NULL;
+		_visibility = NULL;
 		vertices = 0;
 	}
 
@@ -659,42 +770,73 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether or not a vertex is visible from another vertex, i.e.
+ * whether the line between the two doesn't cross any of the polygons
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if vertex is visible from vertex_cur, false otherwise
+ */
+static bool visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
+ * Visibility between two polygon vertices is looked up in (and stored into)
+ * the cached visibility graph when available. The start and end points have
+ * no edges, so they don't affect the visibility between other vertices.
  * @param s				the pathfinding state
  * @param vertex_cur	the vertex
  * @return list of vertices that are visible from vert
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	AvoidPathVisibility *vis = (vertex_cur->visIndex >= 0) ? s->_visibility : NULL;
 
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		if (vertex == vertex_cur)
 			continue;
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+		bool isVisible;
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
+		if (vis && vertex->visIndex >= 0) {
+			byte &entry = vis->visible[vertex_cur->visIndex * vis->vertexCount + vertex->visIndex];
+
+			if (entry == VIS_UNKNOWN)
+				entry = visible(s, vertex_cur, vertex) ? VIS_VISIBLE : VIS_HIDDEN;
+
+			isVisible = (entry == VIS_VISIBLE);
+		} else {
+			isVisible = visible(s, vertex_cur, vertex);
 		}
 
-		if (j == s->vertices)
+		if (isVisible)
 			visVerts->push_front(vertex);
 	}
 
@@ -1081,8 +1223,10 @@ static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
 				Vertex *next = CLIST_NEXT(vertex);
 
 				if (between(vertex->v, next->v, v)) {
-					// Split edge by adding vertex
+					// Split edge by adding vertex. The polygon set no
+					// longer matches the cached visibility graph.
 					polygon->vertices.insertAfter(vertex, v_new);
+					s->_visibility = NULL;
 					return v_new;
 				}
 			}
@@ -1185,6 +1329,59 @@ static void change_polygons_opt_0(PathfindingState *s) {
 	}
 }
 
+/**
+ * Looks up the visibility graph for the polygons of a pathfinding state in
+ * the cache, and assigns the polygon vertices their index into the graph. A
+ * new, empty graph is added to the cache if none matches.
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) pf_s: The pathfinding state
+ * Returns   : (AvoidPathVisibility *) The visibility graph
+ */
+static AvoidPathVisibility *lookup_visibility(EngineState *s, PathfindingState *pf_s) {
+	Common::Array<int16> key;
+	uint count = 0;
+
+	for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it) {
+		Vertex *vertex;
+
+		key.push_back((*it)->vertices.size());
+
+		CLIST_FOREACH(vertex, &(*it)->vertices) {
+			vertex->visIndex = count++;
+			key.push_back(vertex->v.x);
+			key.push_back(vertex->v.y);
+		}
+	}
+
+	Common::List<AvoidPathVisibility *> &cache = s->_avoidPathCache;
+
+	for (Common::List<AvoidPathVisibility *>::iterator it = cache.begin(); it != cache.end(); ++it) {
+		AvoidPathVisibility *vis = *it;
+
+		if (vis->polygons == key) {
+			// Move to the front of the cache
+			cache.erase(it);
+			cache.push_front(vis);
+			return vis;
+		}
+	}
+
+	if (cache.size() >= AVOIDPATH_MAX_CACHED_SETS) {
+		delete cache.back();
+		cache.pop_back();
+	}
+
+	AvoidPathVisibility *vis = new AvoidPathVisibility();
+	vis->polygons = key;
+	vis->vertexCount = count;
+	vis->visible.resize(count * count);
+	for (uint i = 0; i < vis->visible.size(); i++)
+		vis->visible[i] = VIS_UNKNOWN;
+
+	cache.push_front(vis);
+	return vis;
+}
+
 /**
  * Converts the SCI input data for pathfinding
  * Parameters: (EngineState *) s: The game state
@@ -1276,6 +1473,10 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	// The start and end points only affect which polygons are used, so
+	// the visibility graph of the remaining ones can be reused
+	pf_s->_visibility = lookup_visibility(s, pf_s);
+
 	// Merge start and end points into polygon set
 	pf_s->vertex_start = merge_point(pf_s, *new_start);
 	pf_s->vertex_end = merge_point(pf_s, *new_end);
@@ -1310,40 +1511,27 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
+	// The vertices of which the shortest path is not known yet. Vertices of
+	// which the shortest path is known are flagged as closed.
+	VertexHeap openSet;
 
-	// The remaining vertices
-	VertexList openSet;
-
-	openSet.push_front(s->vertex_start);
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	openSet.push(s->vertex_start);
 
 	while (!openSet.empty()) {
-		// Find vertex in open set with lowest F cost
-		VertexList::iterator vertex_min_it = openSet.end();
-		Vertex *vertex_min = 0;
-		uint32 min = HUGE_DISTANCE;
-
-		for (VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
-			Vertex *vertex = *it;
-			if (vertex->costF < min) {
-				vertex_min_it = it;
-				vertex_min = *vertex_min_it;
-				min = vertex->costF;
-			}
-		}
+		// Take vertex in open set with lowest F cost
+		Vertex *vertex_min = openSet.top();
 
-		assert(vertex_min != 0);	// the vertex cost should never be bigger than HUGE_DISTANCE
+		assert(vertex_min->costF < HUGE_DISTANCE);	// the vertex cost should never be bigger than HUGE_DISTANCE
 
 		// Check if we are done
 		if (vertex_min == s->vertex_end)
 			break;
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
-		openSet.erase(vertex_min_it);
+		openSet.pop();
+		vertex_min->closed = true;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
@@ -1351,12 +1539,9 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->closed)
 				continue;
 
-			if (!openSet.contains(vertex))
-				openSet.push_front(vertex);
-
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
 			// When travelling to a vertex on the screen edge, we
@@ -1378,10 +1563,17 @@ static void AStar(PathfindingState *s) {
 			if (s->pointOnScreenBorder(vertex->v) && !qfg1VgaWorkaround)
 				new_dist += 10000;
 
-			if (new_dist < vertex->costG) {
+			if (vertex->heapIndex < 0) {
+				// Not in the open set yet, so its costs are still unset
+				vertex->costG = new_dist;
+				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
+				vertex->path_prev = vertex_min;
+				openSet.push(vertex);
+			} else if (new_dist < vertex->costG) {
 				vertex->costG = new_dist;
 				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
 				vertex->path_prev = vertex_min;
+				openSet.decreased(vertex);
 			}
 		}
 
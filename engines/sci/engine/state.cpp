@@ -79,6 +79,7 @@ EngineState::EngineState(SegManager *segMan)
 }
 
 EngineState::~EngineState() {
+	clearAvoidPathCache();
 	delete _msgState;
 #ifdef ENABLE_SCI32
 	delete _virtualIndexFile;
@@ -127,6 +128,14 @@ void EngineState::reset(bool isRestoring) {
 	_vmdPalEnd = 256;
 
 	_palCycleToColor = 255;
+
+	clearAvoidPathCache();
+}
+
+void EngineState::clearAvoidPathCache() {
+	for (Common::List<AvoidPathVisibility *>::iterator it = _avoidPathCache.begin(); it != _avoidPathCache.end(); ++it)
+		delete *it;
+	_avoidPathCache.clear();
 }
 
 void EngineState::speedThrottler(uint32 neededSleep) {
@@ -95,6 +95,17 @@ struct VideoState {
 	}
 };
 
+/**
+ * Visibility graph of the vertices of a polygon set, used by kAvoidPath.
+ * Scripts tend to pass the same polygons on consecutive calls, so the graph
+ * is kept around and filled in lazily. Refer to kpathing.cpp
+ */
+struct AvoidPathVisibility {
+	Common::Array<int16> polygons; /**< Vertex counts and coordinates of the polygon set */
+	uint vertexCount;
+	Common::Array<byte> visible; /**< vertexCount * vertexCount visibility entries */
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -201,6 +212,13 @@ public:
 
 	uint16 _palCycleToColor;
 
+	/**
+	 * Visibility graphs of recently used kAvoidPath polygon sets, most
+	 * recently used first.
+	 */
+	Common::List<AvoidPathVisibility *> _avoidPathCache;
+	void clearAvoidPathCache();
+
 	/**
 	 * Resets the engine state.
 	 */
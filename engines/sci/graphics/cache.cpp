@@ -35,7 +35,7 @@
 namespace Sci {
 
 GfxCache::GfxCache(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette)
-	: _resMan(resMan), _screen(screen), _palette(palette) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _viewUseCounter(0) {
 }
 
 GfxCache::~GfxCache() {
@@ -59,6 +59,35 @@ void GfxCache::purgeViewCache() {
 	}
 
 	_cachedViews.clear();
+	_viewLastUsed.clear();
+}
+
+void GfxCache::purgeLeastRecentlyUsedView() {
+	ViewCache::iterator oldest = _cachedViews.end();
+	uint32 oldestUse = 0;
+
+	for (ViewCache::iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter) {
+		uint32 lastUse = _viewLastUsed[iter->_key];
+		if (oldest == _cachedViews.end() || lastUse < oldestUse) {
+			oldest = iter;
+			oldestUse = lastUse;
+		}
+	}
+
+	if (oldest != _cachedViews.end()) {
+		_viewLastUsed.erase(oldest->_key);
+		delete oldest->_value;
+		_cachedViews.erase(oldest);
+	}
+}
+
+uint32 GfxCache::getViewCacheSize() const {
+	uint32 size = 0;
+
+	for (ViewCache::const_iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter)
+		size += iter->_value->getCacheSize();
+
+	return size;
 }
 
 GfxFont *GfxCache::getFont(GuiResourceId fontId) {
@@ -77,12 +106,16 @@ GfxFont *GfxCache::getFont(GuiResourceId fontId) {
 }
 
 GfxView *GfxCache::getView(GuiResourceId viewId) {
-	if (_cachedViews.size() >= MAX_CACHED_VIEWS)
-		purgeViewCache();
+	if (!_cachedViews.contains(viewId)) {
+		// Make room by dropping the views that haven't been used for the
+		// longest time, instead of purging the whole cache
+		while (!_cachedViews.empty() && (_cachedViews.size() >= MAX_CACHED_VIEWS || getViewCacheSize() > MAX_CACHED_VIEWS_SIZE))
+			purgeLeastRecentlyUsedView();
 
-	if (!_cachedViews.contains(viewId))
 		_cachedViews[viewId] = new GfxView(_resMan, _screen, _palette, viewId);
+	}
 
+	_viewLastUsed[viewId] = ++_viewUseCounter;
 	return _cachedViews[viewId];
 }
 
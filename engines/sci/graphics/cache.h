@@ -54,6 +54,8 @@ public:
 private:
 	void purgeFontCache();
 	void purgeViewCache();
+	void purgeLeastRecentlyUsedView();
+	uint32 getViewCacheSize() const;
 
 	ResourceManager *_resMan;
 	GfxScreen *_screen;
@@ -61,6 +63,10 @@ private:
 
 	FontCache _cachedFonts;
 	ViewCache _cachedViews;
+
+	// when each cached view was last requested, in getView() calls
+	Common::HashMap<int, uint32> _viewLastUsed;
+	uint32 _viewUseCounter;
 };
 
 } // End of namespace Sci
@@ -59,6 +59,29 @@ enum SciSpeciaPlanelPictureCodes {
 	kPlanePlainColored = 0xffff		// -1
 };
 
+// Above this many changed areas, the whole screen is sent to the backend
+#define MAX_DIRTY_RECTS 32
+
+FrameoutDrawEntry::FrameoutDrawEntry(FrameoutDrawType t)
+	: type(t), object(NULL_REG), picture(0), viewId(0), loopNo(0), celNo(0),
+	  scaleX(128), scaleY(128), x(0), y(0), x2(0), y2(0), planeOffsetX(0),
+	  planeOffsetY(0), flag(false), color(0), priority(0), control(0),
+	  checksum(0), rectOnDisplay(false) {
+}
+
+bool FrameoutDrawEntry::operator==(const FrameoutDrawEntry &entry) const {
+	return type == entry.type && object == entry.object && picture == entry.picture &&
+		viewId == entry.viewId && loopNo == entry.loopNo && celNo == entry.celNo &&
+		scaleX == entry.scaleX && scaleY == entry.scaleY &&
+		x == entry.x && y == entry.y && x2 == entry.x2 && y2 == entry.y2 &&
+		planeOffsetX == entry.planeOffsetX && planeOffsetY == entry.planeOffsetY &&
+		flag == entry.flag && color == entry.color && priority == entry.priority &&
+		control == entry.control && planeRect == entry.planeRect &&
+		celRect == entry.celRect && clipRect == entry.clipRect &&
+		translatedClipRect == entry.translatedClipRect && checksum == entry.checksum &&
+		rect == entry.rect && rectOnDisplay == entry.rectOnDisplay;
+}
+
 GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAdjuster *coordAdjuster, GfxCache *cache, GfxScreen *screen, GfxPalette *palette, GfxPaint32 *paint32)
 	: _segMan(segMan), _resMan(resMan), _cache(cache), _screen(screen), _palette(palette), _paint32(paint32) {
 
@@ -66,6 +89,8 @@ GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAd
 	_curScrollText = -1;
 	_showScrollText = false;
 	_maxScrollTexts = 0;
+	_fullRedraw = true;
+	memset(&_lastSysPalette, 0, sizeof(_lastSysPalette));
 }
 
 GfxFrameout::~GfxFrameout() {
@@ -77,6 +102,13 @@ void GfxFrameout::clear() {
 	_planes.clear();
 	deletePlanePictures(NULL_REG);
 	clearScrollTexts();
+	invalidateScreen();
+}
+
+void GfxFrameout::invalidateScreen() {
+	_lastDrawList.clear();
+	_dirtyRects.clear();
+	_fullRedraw = true;
 }
 
 void GfxFrameout::clearScrollTexts() {
@@ -258,6 +290,7 @@ void GfxFrameout::kernelDeletePlane(reg_t object) {
 
 			// Blackout removed plane rect
 			_paint32->fillRect(planeRect, 0);
+			addDirtyRect(planeRect, false);
 			return;
 		}
 	}
@@ -557,6 +590,8 @@ void GfxFrameout::showVideo() {
 
 		g_system->delayMillis(10);
 	}
+
+	invalidateScreen();
 }
 
 void GfxFrameout::createPlaneItemList(reg_t planeObject, FrameoutList &itemList) {
@@ -624,31 +659,198 @@ bool GfxFrameout::isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect plan
 	return false;
 }
 
-void GfxFrameout::drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored) {
-	int16 pictureOffsetX = planeOffsetX;
-	int16 pictureX = itemEntry->x;
-	if ((planeOffsetX) || (itemEntry->picStartX)) {
-		if (planeOffsetX <= itemEntry->picStartX) {
-			pictureX += itemEntry->picStartX - planeOffsetX;
+void GfxFrameout::drawPicture(const FrameoutDrawEntry &entry, const Common::Rect &clip) {
+	int16 pictureOffsetX = entry.planeOffsetX;
+	int16 pictureX = entry.x;
+	if ((entry.planeOffsetX) || (entry.x2)) {
+		if (entry.planeOffsetX <= entry.x2) {
+			pictureX += entry.x2 - entry.planeOffsetX;
 			pictureOffsetX = 0;
 		} else {
-			pictureOffsetX = planeOffsetX - itemEntry->picStartX;
+			pictureOffsetX = entry.planeOffsetX - entry.x2;
 		}
 	}
 
-	int16 pictureOffsetY = planeOffsetY;
-	int16 pictureY = itemEntry->y;
-	if ((planeOffsetY) || (itemEntry->picStartY)) {
-		if (planeOffsetY <= itemEntry->picStartY) {
-			pictureY += itemEntry->picStartY - planeOffsetY;
+	int16 pictureOffsetY = entry.planeOffsetY;
+	int16 pictureY = entry.y;
+	if ((entry.planeOffsetY) || (entry.y2)) {
+		if (entry.planeOffsetY <= entry.y2) {
+			pictureY += entry.y2 - entry.planeOffsetY;
 			pictureOffsetY = 0;
 		} else {
-			pictureOffsetY = planeOffsetY - itemEntry->picStartY;
+			pictureOffsetY = entry.planeOffsetY - entry.y2;
+		}
+	}
+
+	entry.picture->drawSci32Vga(entry.celNo, pictureX, entry.y, pictureOffsetX, pictureOffsetY, entry.flag, clip);
+	//	warning("picture cel %d %d", entry.celNo, entry.priority);
+}
+
+bool GfxFrameout::isEntryClippable(const FrameoutDrawEntry &entry) const {
+	switch (entry.type) {
+	case kFrameoutDrawLine:
+		return false;
+	case kFrameoutDrawText:
+		// Low resolution fonts are upscaled with their own row mapping
+		return entry.rectOnDisplay || !_screen->getUpscaledHires();
+	default:
+		return true;
+	}
+}
+
+void GfxFrameout::drawEntry(const FrameoutDrawEntry &entry, const Common::Rect &clip) {
+	switch (entry.type) {
+	case kFrameoutDrawFill:
+		_paint32->fillRect(entry.rect.findIntersectingRect(clip), entry.color);
+		break;
+	case kFrameoutDrawLine:
+		// Lines aren't clipped, the dirty area always contains all of them
+		_screen->drawLine(Common::Point(entry.x, entry.y), Common::Point(entry.x2, entry.y2), entry.color, entry.priority, entry.control);
+		break;
+	case kFrameoutDrawPicture:
+		_coordAdjuster->pictureSetDisplayArea(entry.planeRect);
+		drawPicture(entry, clip);
+		break;
+	case kFrameoutDrawView: {
+		// Narrow down the cel area by the same amount as the area on screen
+		Common::Rect translatedClipRect = entry.translatedClipRect.findIntersectingRect(clip);
+		if (translatedClipRect.isEmpty())
+			break;
+		Common::Rect clipRect(translatedClipRect.width(), translatedClipRect.height());
+		clipRect.moveTo(entry.clipRect.left + translatedClipRect.left - entry.translatedClipRect.left,
+			entry.clipRect.top + translatedClipRect.top - entry.translatedClipRect.top);
+
+		GfxView *view = _cache->getView(entry.viewId);
+		Common::Rect celRect = entry.celRect;
+		if ((entry.scaleX == 128) && (entry.scaleY == 128))
+			view->draw(celRect, clipRect, translatedClipRect,
+				entry.loopNo, entry.celNo, 255, 0, entry.flag);
+		else
+			view->drawScaled(celRect, clipRect, translatedClipRect,
+				entry.loopNo, entry.celNo, 255, entry.scaleX, entry.scaleY);
+		break;
+	}
+	case kFrameoutDrawText:
+		if (isEntryClippable(entry))
+			g_sci->_gfxText32->drawTextBitmap(entry.x, entry.y, entry.planeRect, entry.object, &clip);
+		else
+			g_sci->_gfxText32->drawTextBitmap(entry.x, entry.y, entry.planeRect, entry.object);
+		break;
+	}
+}
+
+Common::Rect GfxFrameout::getDisplayRect(Common::Rect rect, bool onDisplay) const {
+	if (!rect.isValidRect())
+		return Common::Rect();
+
+	if (_screen->getUpscaledHires()) {
+		// Widen the area to whole screen pixels, so that it converts exactly
+		// between display and screen coordinates
+		if (onDisplay)
+			rect = getScreenRect(rect);
+		rect.clip(_screen->getWidth(), _screen->getHeight());
+		if (rect.isEmpty())
+			return Common::Rect();
+		_screen->adjustToUpscaledCoordinates(rect.top, rect.left);
+		_screen->adjustToUpscaledCoordinates(rect.bottom, rect.right);
+	}
+
+	rect.clip(_screen->getDisplayWidth(), _screen->getDisplayHeight());
+	return rect;
+}
+
+Common::Rect GfxFrameout::getScreenRect(const Common::Rect &displayRect) const {
+	if (!_screen->getUpscaledHires())
+		return displayRect;
+
+	// All upscaled modes map screen pixels by rounding down, so rounding
+	// outwards here gives the screen pixels covering the display area
+	int16 width = _screen->getWidth(), height = _screen->getHeight();
+	int16 displayWidth = _screen->getDisplayWidth(), displayHeight = _screen->getDisplayHeight();
+	return Common::Rect((displayRect.left * width) / displayWidth,
+		(displayRect.top * height) / displayHeight,
+		(displayRect.right * width + displayWidth - 1) / displayWidth,
+		(displayRect.bottom * height + displayHeight - 1) / displayHeight);
+}
+
+void GfxFrameout::addDirtyRect(Common::Rect rect, bool onDisplay) {
+	rect = getDisplayRect(rect, onDisplay);
+	if (rect.isEmpty())
+		return;
+
+	// Merge overlapping areas, so that nothing gets drawn or copied twice
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		if (_dirtyRects[i].intersects(rect)) {
+			rect.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
 		}
 	}
+	_dirtyRects.push_back(rect);
+}
+
+void GfxFrameout::updateDirtyRects(const FrameoutDrawList &drawList) {
+	// Operations that match the ones at the same position in the previous
+	// frame produce the same pixels. Everything else changed the area that
+	// it touches now or touched before.
+	uint count = MAX(drawList.size(), _lastDrawList.size());
+	for (uint i = 0; i < count; i++) {
+		if (i < drawList.size() && i < _lastDrawList.size() && drawList[i] == _lastDrawList[i])
+			continue;
+		if (i < drawList.size())
+			addDirtyRect(drawList[i].rect, drawList[i].rectOnDisplay);
+		if (i < _lastDrawList.size())
+			addDirtyRect(_lastDrawList[i].rect, _lastDrawList[i].rectOnDisplay);
+	}
+
+	// Operations that can't be clipped get redrawn as a whole, so the dirty
+	// areas need to cover all of them
+	bool grown;
+	do {
+		grown = false;
+		for (uint i = 0; i < drawList.size() && !grown; i++) {
+			if (isEntryClippable(drawList[i]))
+				continue;
+			Common::Rect rect = getDisplayRect(drawList[i].rect, drawList[i].rectOnDisplay);
+			for (uint j = 0; j < _dirtyRects.size(); j++) {
+				if (_dirtyRects[j].intersects(rect) && !_dirtyRects[j].contains(rect)) {
+					addDirtyRect(drawList[i].rect, drawList[i].rectOnDisplay);
+					grown = true;
+					break;
+				}
+			}
+		}
+	} while (grown);
+}
+
+void GfxFrameout::drawDirtyRects(const FrameoutDrawList &drawList) {
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &displayRect = _dirtyRects[i];
+		const Common::Rect screenRect = getScreenRect(displayRect);
 
-	itemEntry->picture->drawSci32Vga(itemEntry->celNo, pictureX, itemEntry->y, pictureOffsetX, pictureOffsetY, planePictureMirrored);
-	//	warning("picture cel %d %d", itemEntry->celNo, itemEntry->priority);
+		for (FrameoutDrawList::const_iterator it = drawList.begin(); it != drawList.end(); ++it) {
+			const Common::Rect &clip = it->rectOnDisplay ? displayRect : screenRect;
+			if (it->rect.intersects(clip))
+				drawEntry(*it, clip);
+		}
+	}
+}
+
+void GfxFrameout::copyDirtyRectsToScreen() {
+	if (_fullRedraw || _dirtyRects.size() > MAX_DIRTY_RECTS) {
+		_screen->copyToScreen();
+	} else {
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (_screen->getUpscaledHires())
+				_screen->copyDisplayRectToScreen(_dirtyRects[i]);
+			else
+				_screen->copyRectToScreen(_dirtyRects[i]);
+		}
+	}
+	_dirtyRects.clear();
 }
 
 void GfxFrameout::kernelFrameout() {
@@ -659,6 +861,10 @@ void GfxFrameout::kernelFrameout() {
 
 	_palette->palVaryUpdate();
 
+	// Lay out the frame first and collect its drawing operations, so that
+	// they can be compared against the ones of the previous frame
+	FrameoutDrawList drawList;
+
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
 		reg_t planeObject = it->object;
 
@@ -671,7 +877,18 @@ void GfxFrameout::kernelFrameout() {
 			Common::Point endPoint = it2->endPoint;
 			_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
 			_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
-			_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
+
+			FrameoutDrawEntry line(kFrameoutDrawLine);
+			line.x = startPoint.x;
+			line.y = startPoint.y;
+			line.x2 = endPoint.x;
+			line.y2 = endPoint.y;
+			line.color = it2->color;
+			line.priority = it2->priority;
+			line.control = it2->control;
+			line.rect = Common::Rect(MIN(line.x, line.x2), MIN(line.y, line.y2),
+				MAX(line.x, line.x2) + 1, MAX(line.y, line.y2) + 1);
+			drawList.push_back(line);
 		}
 
 		int16 planeLastPriority = it->lastPriority;
@@ -682,8 +899,11 @@ void GfxFrameout::kernelFrameout() {
 		it->lastPriority = planePriority;
 		if (planePriority < 0) { // Plane currently not meant to be shown
 			// If plane was shown before, delete plane rect
-			if (planePriority != planeLastPriority)
-				_paint32->fillRect(it->planeRect, 0);
+			if (planePriority != planeLastPriority) {
+				FrameoutDrawEntry fill(kFrameoutDrawFill);
+				fill.rect = it->planeRect;
+				drawList.push_back(fill);
+			}
 			continue;
 		}
 
@@ -691,8 +911,12 @@ void GfxFrameout::kernelFrameout() {
 		// Since I first wrote the patch, the race has stopped occurring for me though.
 		// I'll leave this for investigation later, when someone can reproduce.
 		//if (it->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
-		if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1))
-			_paint32->fillRect(it->planeRect, it->planeBack);
+		if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1)) {
+			FrameoutDrawEntry fill(kFrameoutDrawFill);
+			fill.rect = it->planeRect;
+			fill.color = it->planeBack;
+			drawList.push_back(fill);
+		}
 
 		_coordAdjuster->pictureSetDisplayArea(it->planeRect);
 		// Invoking drewPicture() with an invalid picture ID in SCI32 results in
@@ -718,8 +942,22 @@ void GfxFrameout::kernelFrameout() {
 				_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
 				_coordAdjuster->fromScriptToDisplay(itemEntry->picStartY, itemEntry->picStartX);
 
-				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
-					drawPicture(itemEntry, it->planeOffsetX, it->planeOffsetY, it->planePictureMirrored);
+				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY)) {
+					FrameoutDrawEntry picture(kFrameoutDrawPicture);
+					picture.picture = itemEntry->picture;
+					picture.viewId = itemEntry->picture->getResourceId();
+					picture.celNo = itemEntry->celNo;
+					picture.x = itemEntry->x;
+					picture.y = itemEntry->y;
+					picture.x2 = itemEntry->picStartX;
+					picture.y2 = itemEntry->picStartY;
+					picture.planeOffsetX = it->planeOffsetX;
+					picture.planeOffsetY = it->planeOffsetY;
+					picture.flag = it->planePictureMirrored;
+					picture.planeRect = it->planeRect;
+					picture.rect = it->planeRect;
+					drawList.push_back(picture);
+				}
 			} else {
 				GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
 				int16 dummyX = 0;
@@ -821,20 +1059,32 @@ void GfxFrameout::kernelFrameout() {
 					translatedClipRect.translate(it->planeRect.left, it->planeRect.top);
 				}
 
-				if (view) {
-					if (!clipRect.isEmpty()) {
-						if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-							view->draw(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
-						else
-							view->drawScaled(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
-					}
+				if (view && !clipRect.isEmpty()) {
+					FrameoutDrawEntry cel(kFrameoutDrawView);
+					cel.object = itemEntry->object;
+					cel.viewId = itemEntry->viewId;
+					cel.loopNo = itemEntry->loopNo;
+					cel.celNo = itemEntry->celNo;
+					cel.scaleX = itemEntry->scaleX;
+					cel.scaleY = itemEntry->scaleY;
+					cel.flag = view->isSci2Hires();
+					cel.celRect = itemEntry->celRect;
+					cel.clipRect = clipRect;
+					cel.translatedClipRect = translatedClipRect;
+					cel.rect = translatedClipRect;
+					cel.rectOnDisplay = cel.flag;
+					drawList.push_back(cel);
 				}
 
 				// Draw text, if it exists
 				if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
-					g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, it->planeRect, itemEntry->object);
+					FrameoutDrawEntry text(kFrameoutDrawText);
+					text.object = itemEntry->object;
+					text.x = itemEntry->x;
+					text.y = itemEntry->y;
+					text.planeRect = it->planeRect;
+					if (g_sci->_gfxText32->getTextBitmapArea(text.x, text.y, text.planeRect, text.object, text.rect, text.rectOnDisplay, text.checksum))
+						drawList.push_back(text);
 				}
 			}
 		}
@@ -847,9 +1097,44 @@ void GfxFrameout::kernelFrameout() {
 		}
 	}
 
-	showCurrentScrollText();
+	// A changed palette or active color remapping alters the drawn pixels
+	// without changing the operations themselves
+	Palette sysPalette;
+	_palette->getSys(&sysPalette);
+	if (memcmp(sysPalette.colors, _lastSysPalette.colors, sizeof(sysPalette.colors)) ||
+		memcmp(sysPalette.intensity, _lastSysPalette.intensity, sizeof(sysPalette.intensity)) ||
+		memcmp(sysPalette.mapping, _lastSysPalette.mapping, sizeof(sysPalette.mapping)) ||
+		_palette->isRemapping())
+		_fullRedraw = true;
+
+	// Scroll texts are drawn on top of everything else, outside of the
+	// operations list
+	bool showScrollText = _showScrollText && _curScrollText >= 0 && !_scrollTexts.empty();
+	if (showScrollText)
+		_fullRedraw = true;
+
+	// Only the operations touching a changed area are drawn again, clipped to
+	// that area. A frame that is identical to the previous one isn't drawn at
+	// all.
+	if (_fullRedraw) {
+		_dirtyRects.clear();
+		_dirtyRects.push_back(Common::Rect(_screen->getDisplayWidth(), _screen->getDisplayHeight()));
+	} else {
+		updateDirtyRects(drawList);
+	}
+
+	if (!_dirtyRects.empty()) {
+		drawDirtyRects(drawList);
+
+		showCurrentScrollText();
+
+		copyDirtyRectsToScreen();
+		_palette->getSys(&_lastSysPalette);
+	}
 
-	_screen->copyToScreen();
+	_lastDrawList = drawList;
+	// Redraw once more after the scroll text got hidden
+	_fullRedraw = showScrollText;
 
 	g_sci->getEngineState()->_throttleTrigger = true;
 }
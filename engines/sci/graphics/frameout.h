@@ -97,6 +97,50 @@ struct ScrollTextEntry {
 
 typedef Common::Array<ScrollTextEntry> ScrollTextList;
 
+enum FrameoutDrawType {
+	kFrameoutDrawFill,
+	kFrameoutDrawLine,
+	kFrameoutDrawPicture,
+	kFrameoutDrawView,
+	kFrameoutDrawText
+};
+
+/**
+ * A single drawing operation of a frame. The operations of consecutive frames
+ * are compared, so that only the parts of the screen that changed get redrawn
+ * and sent to the backend. Redrawn operations are clipped to those parts.
+ */
+struct FrameoutDrawEntry {
+	FrameoutDrawType type;
+	reg_t object;			// screen item (views, text)
+	GfxPicture *picture;	// picture cels
+	GuiResourceId viewId;
+	int16 loopNo;
+	int16 celNo;
+	int16 scaleX;
+	int16 scaleY;
+	int16 x, y;				// item position, line start point
+	int16 x2, y2;			// picture start position, line end point
+	int16 planeOffsetX;
+	int16 planeOffsetY;
+	bool flag;				// mirrored picture, hires view
+	byte color;
+	byte priority;
+	byte control;
+	Common::Rect planeRect;
+	Common::Rect celRect;
+	Common::Rect clipRect;
+	Common::Rect translatedClipRect;
+	uint32 checksum;		// contents of text bitmaps
+	Common::Rect rect;		// screen area touched by this operation
+	bool rectOnDisplay;		// rect is in display instead of screen coordinates
+
+	FrameoutDrawEntry(FrameoutDrawType t);
+	bool operator==(const FrameoutDrawEntry &entry) const;
+};
+
+typedef Common::Array<FrameoutDrawEntry> FrameoutDrawList;
+
 enum ViewScaleSignals32 {
 	kScaleSignalDoScaling32				= 0x0001, // enables scaling when drawing that cel (involves scaleX and scaleY)
 	kScaleSignalUnk1					= 0x0002, // unknown
@@ -151,11 +195,25 @@ public:
 	void printPlaneList(Console *con);
 	void printPlaneItemList(Console *con, reg_t planeObject);
 
+	/**
+	 * Makes the next kFrameout redraw the whole screen and send it to the
+	 * backend. Needs to be called when something else has drawn to the screen.
+	 */
+	void invalidateScreen();
+
 private:
 	void showVideo();
 	void createPlaneItemList(reg_t planeObject, FrameoutList &itemList);
 	bool isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect planeRect, int16 planeOffsetX, int16 planeOffsetY);
-	void drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored);
+	void drawPicture(const FrameoutDrawEntry &entry, const Common::Rect &clip);
+	bool isEntryClippable(const FrameoutDrawEntry &entry) const;
+	void drawEntry(const FrameoutDrawEntry &entry, const Common::Rect &clip);
+	Common::Rect getDisplayRect(Common::Rect rect, bool onDisplay) const;
+	Common::Rect getScreenRect(const Common::Rect &displayRect) const;
+	void addDirtyRect(Common::Rect rect, bool onDisplay);
+	void updateDirtyRects(const FrameoutDrawList &drawList);
+	void drawDirtyRects(const FrameoutDrawList &drawList);
+	void copyDirtyRectsToScreen();
 
 	SegManager *_segMan;
 	ResourceManager *_resMan;
@@ -173,6 +231,13 @@ private:
 	bool _showScrollText;
 	uint16 _maxScrollTexts;
 
+	// Drawing operations of the previous frame, and the display areas that
+	// changed since then
+	FrameoutDrawList _lastDrawList;
+	Common::Array<Common::Rect> _dirtyRects;
+	bool _fullRedraw;
+	Palette _lastSysPalette;
+
 	void sortPlanes();
 };
 
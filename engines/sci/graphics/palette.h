@@ -71,6 +71,7 @@ public:
 	bool isRemapped(byte color) const {
 		return _remapOn && (_remappingType[color] != kRemappingNone);
 	}
+	bool isRemapping() const { return _remapOn; }
 	byte remapColor(byte remappedColor, byte screenColor);
 
 	void setOnScreen();
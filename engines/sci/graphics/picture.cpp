@@ -67,6 +67,7 @@ void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int1
 	_addToFlag = addToFlag;
 	_EGApaletteNo = EGApaletteNo;
 	_priority = 0;
+	_clipRect = Common::Rect(_screen->getWidth(), _screen->getHeight());
 
 	headerSize = READ_LE_UINT16(_resource->data);
 	switch (headerSize) {
@@ -77,7 +78,7 @@ void GfxPicture::draw(int16 animationNr, bool mirroredFlag, bool addToFlag, int1
 #ifdef ENABLE_SCI32
 	case 0x0e: // SCI32 VGA picture
 		_resourceType = SCI_PICTURE_TYPE_SCI32;
-		drawSci32Vga(0, 0, 0, 0, 0, false);
+		drawSci32Vga(0, 0, 0, 0, 0, false, _clipRect);
 		break;
 #endif
 	default:
@@ -187,7 +188,7 @@ int16 GfxPicture::getSci32celPriority(int16 celNo) {
 	return READ_SCI11ENDIAN_UINT16(inbuffer + cel_headerPos + 36);
 }
 
-void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictureX, int16 pictureY, bool mirrored) {
+void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictureX, int16 pictureY, bool mirrored, const Common::Rect &clipRect) {
 	byte *inbuffer = _resource->data;
 	int size = _resource->size;
 	int header_size = READ_SCI11ENDIAN_UINT16(inbuffer);
@@ -201,6 +202,7 @@ void GfxPicture::drawSci32Vga(int16 celNo, int16 drawX, int16 drawY, int16 pictu
 	_mirroredFlag = mirrored;
 	_addToFlag = false;
 	_resourceType = SCI_PICTURE_TYPE_SCI32;
+	_clipRect = clipRect;
 
 	if (celNo == 0) {
 		// Create palette and set it
@@ -348,6 +350,35 @@ void GfxPicture::drawCelData(byte *inbuffer, int size, int headerPos, int rlePos
 		leftX = displayArea.left + drawX;
 		rightX = MIN<int16>(displayWidth + leftX, displayArea.right);
 
+		ptr = celBitmap;
+		ptr += skipCelBitmapPixels;
+		ptr += skipCelBitmapLines * width;
+
+		// Only draw the part inside the clip rect. Rows are always width
+		// pixels apart in the bitmap, mirrored rows start at the right edge.
+		if (y < _clipRect.top) {
+			ptr += (_clipRect.top - y) * width;
+			y = _clipRect.top;
+		}
+		lastY = MIN<int16>(lastY, _clipRect.bottom);
+		if (_mirroredFlag) {
+			if (rightX > _clipRect.right) {
+				ptr += rightX - _clipRect.right;
+				rightX = _clipRect.right;
+			}
+			leftX = MAX<int16>(leftX, _clipRect.left);
+		} else {
+			if (leftX < _clipRect.left) {
+				ptr += _clipRect.left - leftX;
+				leftX = _clipRect.left;
+			}
+			rightX = MIN<int16>(rightX, _clipRect.right);
+		}
+		if (leftX >= rightX || y >= lastY) {
+			delete[] celBitmap;
+			return;
+		}
+
 		uint16 sourcePixelSkipPerRow = 0;
 		if (width > rightX - leftX)
 			sourcePixelSkipPerRow = width - (rightX - leftX);
@@ -362,10 +393,6 @@ void GfxPicture::drawCelData(byte *inbuffer, int size, int headerPos, int rlePos
 
 		byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL | GFX_SCREEN_MASK_PRIORITY;
 
-		ptr = celBitmap;
-		ptr += skipCelBitmapPixels;
-		ptr += skipCelBitmapLines * width;
-
 		if ((!isEGA) || (priority < 16)) {
 			// VGA + EGA, EGA only checks priority, when given priority is below 16
 			if (!_mirroredFlag) {
@@ -58,7 +58,7 @@ public:
 	int16 getSci32celWidth(int16 celNo);
 	int16 getSci32celHeight(int16 celNo);
 	int16 getSci32celPriority(int16 celNo);
-	void drawSci32Vga(int16 celNo, int16 callerX, int16 callerY, int16 pictureX, int16 pictureY, bool mirrored);
+	void drawSci32Vga(int16 celNo, int16 callerX, int16 callerY, int16 pictureX, int16 pictureY, bool mirrored, const Common::Rect &clipRect);
 #endif
 
 private:
@@ -95,6 +95,8 @@ private:
 	bool _addToFlag;
 	int16 _EGApaletteNo;
 	byte _priority;
+	// Cel data is only drawn inside this area of the screen
+	Common::Rect _clipRect;
 
 	// If true, we will show the whole EGA drawing process...
 	bool _EGAdrawingVisualize;
@@ -199,9 +199,53 @@ void GfxText32::disposeTextBitmap(reg_t hunkId) {
 	_segMan->freeHunkEntry(hunkId);
 }
 
-void GfxText32::drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject) {
+/**
+ * Draws the text bitmap of textObject. If clipRect is given, only the pixels
+ * inside it are drawn. It uses the same coordinates as getTextBitmapArea().
+ */
+void GfxText32::drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, const Common::Rect *clipRect) {
 	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
-	drawTextBitmapInternal(x, y, planeRect, textObject, hunkId);
+	drawTextBitmapInternal(x, y, planeRect, textObject, hunkId, clipRect);
+}
+
+/**
+ * Returns the screen area that drawTextBitmap() would draw to, and a checksum
+ * of the text bitmap, so that callers can find out whether the text changed.
+ * The area is in display coordinates if onDisplay is set, and in screen
+ * coordinates otherwise. Returns false if nothing would be drawn.
+ */
+bool GfxText32::getTextBitmapArea(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, Common::Rect &area, bool &onDisplay, uint32 &checksum) {
+	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
+
+	if (hunkId.isNull() || x < 0 || y < 0)
+		return false;
+
+	byte *memoryPtr = _segMan->getHunkPointer(hunkId);
+	if (!memoryPtr)
+		return false;
+
+	uint16 textX = planeRect.left + x;
+	uint16 textY = planeRect.top + y;
+	uint16 width = READ_LE_UINT16(memoryPtr);
+	uint16 height = READ_LE_UINT16(memoryPtr + 2);
+
+	onDisplay = _screen->fontIsUpscaled();
+	if (onDisplay) {
+		textX = textX * _screen->getDisplayWidth() / _screen->getWidth();
+		textY = textY * _screen->getDisplayHeight() / _screen->getHeight();
+	}
+
+	area = Common::Rect(textX, textY, textX + width, textY + height);
+
+	// The colors used for transparency are part of the checksum as well
+	checksum = (uint16)readSelectorValue(_segMan, textObject, SELECTOR(back));
+	checksum = checksum * 31 + (uint16)readSelectorValue(_segMan, textObject, SELECTOR(skip));
+
+	const byte *surface = memoryPtr + BITMAP_HEADER_SIZE;
+	for (uint32 i = 0; i < (uint32)width * height; i++)
+		checksum = checksum * 31 + surface[i];
+
+	return true;
 }
 
 void GfxText32::drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, uint16 y) {
@@ -218,7 +262,7 @@ void GfxText32::drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, u
 	drawTextBitmapInternal(0, 0, Common::Rect(20, 390, 600, 460), textObject, hunkId);
 }
 
-void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId) {
+void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId, const Common::Rect *clipRect) {
 	int16 backColor = (int16)readSelectorValue(_segMan, textObject, SELECTOR(back));
 	// Sanity check: Check if the hunk is set. If not, either the game scripts
 	// didn't set it, or an old saved game has been loaded, where it wasn't set.
@@ -256,8 +300,17 @@ void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect,
 
 	bool translucent = (skipColor == -1 && backColor == -1);
 
-	for (int curY = 0; curY < height; curY++) {
-		for (int curX = 0; curX < width; curX++) {
+	int firstX = 0, lastX = width, firstY = 0, lastY = height;
+	if (clipRect) {
+		firstX = CLIP<int>(clipRect->left - textX, 0, width);
+		lastX = CLIP<int>(clipRect->right - textX, firstX, width);
+		firstY = CLIP<int>(clipRect->top - textY, 0, height);
+		lastY = CLIP<int>(clipRect->bottom - textY, firstY, height);
+	}
+
+	for (int curY = firstY; curY < lastY; curY++) {
+		curByte = curY * width + firstX;
+		for (int curX = firstX; curX < lastX; curX++) {
 			byte pixel = surface[curByte++];
 			if ((!translucent && pixel != skipColor && pixel != backColor) ||
 				(translucent && pixel != 0xFF))
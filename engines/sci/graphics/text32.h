@@ -34,7 +34,8 @@ public:
 	~GfxText32();
 	reg_t createTextBitmap(reg_t textObject, uint16 maxWidth = 0, uint16 maxHeight = 0, reg_t prevHunk = NULL_REG);
 	reg_t createScrollTextBitmap(Common::String text, reg_t textObject, uint16 maxWidth = 0, uint16 maxHeight = 0, reg_t prevHunk = NULL_REG);
-	void drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject);
+	void drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, const Common::Rect *clipRect = NULL);
+	bool getTextBitmapArea(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, Common::Rect &area, bool &onDisplay, uint32 &checksum);
 	void drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, uint16 y);
 	void disposeTextBitmap(reg_t hunkId);
 	int16 GetLongest(const char *text, int16 maxWidth, GfxFont *font);
@@ -43,7 +44,7 @@ public:
 
 private:
 	reg_t createTextBitmapInternal(Common::String &text, reg_t textObject, uint16 maxWidth, uint16 maxHeight, reg_t hunkId);
-	void drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId);
+	void drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId, const Common::Rect *clipRect = NULL);
 	int16 Size(Common::Rect &rect, const char *text, GuiResourceId fontId, int16 maxWidth);
 	void Width(const char *text, int16 from, int16 len, GuiResourceId orgFontId, int16 &textWidth, int16 &textHeight, bool restoreFont);
 	void StringWidth(const char *str, GuiResourceId orgFontId, int16 &textWidth, int16 &textHeight);
@@ -31,13 +31,15 @@
 namespace Sci {
 
 GfxView::GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId)
-	: _resMan(resMan), _screen(screen), _palette(palette), _resourceId(resourceId) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _resourceId(resourceId), _cacheSize(0) {
 	assert(resourceId != -1);
 	_coordAdjuster = g_sci->_gfxCoordAdjuster;
 	initData(resourceId);
 }
 
 GfxView::~GfxView() {
+	purgeCelCache();
+
 	// Iterate through the loops
 	for (uint16 loopNum = 0; loopNum < _loopCount; loopNum++) {
 		// and through the cells of each loop
@@ -704,6 +706,7 @@ const byte *GfxView::getBitmap(int16 loopNo, int16 celNo) {
 	int pixelCount = width * height;
 	_loop[loopNo].cel[celNo].rawBitmap = new byte[pixelCount];
 	byte *pBitmap = _loop[loopNo].cel[celNo].rawBitmap;
+	_cacheSize += pixelCount;
 
 	// unpack the actual cel bitmap data
 	unpackCel(loopNo, celNo, pBitmap, pixelCount);
@@ -847,10 +850,19 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 		priority = 14;
 
 	if (!_EGAmapping) {
+		// Only walk through the opaque pixels of each row
+		const CachedCel *cachedCel = getCachedCel(loopNo, celNo, 128, 128);
+		const int16 offsetX = clipRect.left - rect.left;
+		const int16 offsetY = clipRect.top - rect.top;
+
 		for (y = 0; y < height; y++, bitmap += celWidth) {
-			for (x = 0; x < width; x++) {
-				const byte color = bitmap[x];
-				if (color != clearKey) {
+			const uint32 spanEnd = cachedCel->rowStart[y + offsetY + 1];
+			for (uint32 spanNo = cachedCel->rowStart[y + offsetY]; spanNo < spanEnd; spanNo++) {
+				const CelSpan &span = cachedCel->spans[spanNo];
+				const int startX = MAX<int>(span.x - offsetX, 0);
+				const int endX = MIN<int>(span.x + span.width - offsetX, width);
+				for (x = startX; x < endX; x++) {
+					const byte color = bitmap[x];
 					const int x2 = clipRectTranslated.left + x;
 					const int y2 = clipRectTranslated.top + y;
 					if (!upscaledHires) {
@@ -893,33 +905,13 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
  * is definitely not pixel-perfect with the one sierra is using. It shouldn't
  * matter because the scaled cel rect is definitely the same as in sierra sci.
  */
-void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated,
-			int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY) {
-	const Palette *palette = _embeddedPal ? &_viewPalette : &_palette->_sysPalette;
-	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
-	const byte *bitmap = getBitmap(loopNo, celNo);
-	const int16 celHeight = celInfo->height;
-	const int16 celWidth = celInfo->width;
-	const byte clearKey = celInfo->clearKey;
-	const byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL|GFX_SCREEN_MASK_PRIORITY;
+void GfxView::createScaledBitmap(CachedCel *cachedCel, const byte *bitmap, int16 celWidth, int16 celHeight) {
+	const int16 scaledWidth = cachedCel->width;
+	const int16 scaledHeight = cachedCel->height;
 	uint16 scalingX[640];
 	uint16 scalingY[480];
-	int16 scaledWidth, scaledHeight;
 	int pixelNo, scaledPixel, scaledPixelNo, prevScaledPixelNo;
 
-	if (_embeddedPal)
-		// Merge view palette in...
-		_palette->set(&_viewPalette, false);
-
-	scaledWidth = (celInfo->width * scaleX) >> 7;
-	scaledHeight = (celInfo->height * scaleY) >> 7;
-	scaledWidth = CLIP<int16>(scaledWidth, 0, _screen->getWidth());
-	scaledHeight = CLIP<int16>(scaledHeight, 0, _screen->getHeight());
-
-	// Do we really need to do this?!
-	//memset(scalingX, 0, sizeof(scalingX));
-	//memset(scalingY, 0, sizeof(scalingY));
-
 	// Create height scaling table
 	pixelNo = 0;
 	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
@@ -929,7 +921,7 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
 			scalingY[prevScaledPixelNo] = pixelNo;
 		pixelNo++;
-		scaledPixel += scaleY;
+		scaledPixel += cachedCel->scaleY;
 	}
 	pixelNo--;
 	scaledPixelNo++;
@@ -945,15 +937,123 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
 			scalingX[prevScaledPixelNo] = pixelNo;
 		pixelNo++;
-		scaledPixel += scaleX;
+		scaledPixel += cachedCel->scaleX;
 	}
 	pixelNo--;
 	scaledPixelNo++;
 	for (; scaledPixelNo < scaledWidth; scaledPixelNo++)
 		scalingX[scaledPixelNo] = pixelNo;
 
-	scaledWidth = MIN(clipRect.width(), scaledWidth);
-	scaledHeight = MIN(clipRect.height(), scaledHeight);
+	assert(scaledHeight <= ARRAYSIZE(scalingY));
+	assert(scaledWidth <= ARRAYSIZE(scalingX));
+
+	// Scale the whole cel once, so that drawing it again with the same
+	// scaling is just a copy of its opaque pixels
+	cachedCel->scaledBitmap = new byte[scaledWidth * scaledHeight];
+	byte *scaledPtr = cachedCel->scaledBitmap;
+	for (int y = 0; y < scaledHeight; y++) {
+		const byte *rowPtr = bitmap + scalingY[y] * celWidth;
+		for (int x = 0; x < scaledWidth; x++)
+			*scaledPtr++ = rowPtr[scalingX[x]];
+	}
+}
+
+uint32 CachedCel::getSize() const {
+	uint32 size = sizeof(CachedCel) + rowStart.size() * sizeof(uint32) + spans.size() * sizeof(CelSpan);
+	if (scaledBitmap)
+		size += width * height;
+	return size;
+}
+
+/**
+ * Returns the cel in the given scaling, together with the runs of its opaque
+ * pixels. Scaled variants and span lists of recently drawn cels are cached,
+ * as actors usually get drawn with the same cel and scaling for several frames.
+ */
+const CachedCel *GfxView::getCachedCel(int16 loopNo, int16 celNo, int16 scaleX, int16 scaleY) {
+	loopNo = CLIP<int16>(loopNo, 0, _loopCount - 1);
+	celNo = CLIP<int16>(celNo, 0, _loop[loopNo].celCount - 1);
+
+	for (Common::List<CachedCel *>::iterator it = _cachedCels.begin(); it != _cachedCels.end(); ++it) {
+		CachedCel *cachedCel = *it;
+		if (cachedCel->loopNo == loopNo && cachedCel->celNo == celNo && cachedCel->scaleX == scaleX && cachedCel->scaleY == scaleY) {
+			if (it != _cachedCels.begin()) {
+				_cachedCels.erase(it);
+				_cachedCels.push_front(cachedCel);
+			}
+			return cachedCel;
+		}
+	}
+
+	if (_cachedCels.size() >= MAX_CACHED_CELS) {
+		_cacheSize -= _cachedCels.back()->getSize();
+		delete _cachedCels.back();
+		_cachedCels.pop_back();
+	}
+
+	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
+	const byte *bitmap = getBitmap(loopNo, celNo);
+	const byte clearKey = celInfo->clearKey;
+	CachedCel *cachedCel = new CachedCel();
+
+	cachedCel->loopNo = loopNo;
+	cachedCel->celNo = celNo;
+	cachedCel->scaleX = scaleX;
+	cachedCel->scaleY = scaleY;
+
+	if (scaleX == 128 && scaleY == 128) {
+		cachedCel->width = celInfo->width;
+		cachedCel->height = celInfo->height;
+	} else {
+		cachedCel->width = CLIP<int16>((celInfo->width * scaleX) >> 7, 0, _screen->getWidth());
+		cachedCel->height = CLIP<int16>((celInfo->height * scaleY) >> 7, 0, _screen->getHeight());
+		createScaledBitmap(cachedCel, bitmap, celInfo->width, celInfo->height);
+		bitmap = cachedCel->scaledBitmap;
+	}
+
+	// Collect the runs of opaque pixels
+	cachedCel->rowStart.resize(cachedCel->height + 1);
+	for (int16 y = 0; y < cachedCel->height; y++, bitmap += cachedCel->width) {
+		cachedCel->rowStart[y] = cachedCel->spans.size();
+		int16 x = 0;
+		while (x < cachedCel->width) {
+			while (x < cachedCel->width && bitmap[x] == clearKey)
+				x++;
+			if (x == cachedCel->width)
+				break;
+
+			CelSpan span;
+			span.x = x;
+			while (x < cachedCel->width && bitmap[x] != clearKey)
+				x++;
+			span.width = x - span.x;
+			cachedCel->spans.push_back(span);
+		}
+	}
+	cachedCel->rowStart[cachedCel->height] = cachedCel->spans.size();
+
+	_cachedCels.push_front(cachedCel);
+	_cacheSize += cachedCel->getSize();
+	return cachedCel;
+}
+
+void GfxView::purgeCelCache() {
+	for (Common::List<CachedCel *>::iterator it = _cachedCels.begin(); it != _cachedCels.end(); ++it) {
+		_cacheSize -= (*it)->getSize();
+		delete *it;
+	}
+	_cachedCels.clear();
+}
+
+void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated,
+			int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY) {
+	const Palette *palette = _embeddedPal ? &_viewPalette : &_palette->_sysPalette;
+	const CachedCel *cachedCel = getCachedCel(loopNo, celNo, scaleX, scaleY);
+	const byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL|GFX_SCREEN_MASK_PRIORITY;
+
+	if (_embeddedPal)
+		// Merge view palette in...
+		_palette->set(&_viewPalette, false);
 
 	const int16 offsetY = clipRect.top - rect.top;
 	const int16 offsetX = clipRect.left - rect.left;
@@ -962,19 +1062,29 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 	if (offsetX < 0 || offsetY < 0)
 		return;
 
-	assert(scaledHeight + offsetY <= ARRAYSIZE(scalingY));
-	assert(scaledWidth + offsetX <= ARRAYSIZE(scalingX));
+	const int16 scaledWidth = MIN<int16>(clipRect.width(), cachedCel->width - offsetX);
+	const int16 scaledHeight = MIN<int16>(clipRect.height(), cachedCel->height - offsetY);
+
+	const byte *celBitmap = cachedCel->scaledBitmap ? cachedCel->scaledBitmap : getBitmap(loopNo, celNo);
+
 	for (int y = 0; y < scaledHeight; y++) {
-		for (int x = 0; x < scaledWidth; x++) {
-			const byte color = bitmap[scalingY[y + offsetY] * celWidth + scalingX[x + offsetX]];
-			const int x2 = clipRectTranslated.left + x;
-			const int y2 = clipRectTranslated.top + y;
-			if (color != clearKey && priority >= _screen->getPriority(x2, y2)) {
-				if (!_palette->isRemapped(palette->mapping[color])) {
-					_screen->putPixel(x2, y2, drawMask, palette->mapping[color], priority, 0);
-				} else {
-					byte remappedColor = _palette->remapColor(palette->mapping[color], _screen->getVisual(x2, y2));
-					_screen->putPixel(x2, y2, drawMask, remappedColor, priority, 0);
+		const byte *bitmap = celBitmap + (y + offsetY) * cachedCel->width + offsetX;
+		const uint32 spanEnd = cachedCel->rowStart[y + offsetY + 1];
+		for (uint32 spanNo = cachedCel->rowStart[y + offsetY]; spanNo < spanEnd; spanNo++) {
+			const CelSpan &span = cachedCel->spans[spanNo];
+			const int startX = MAX<int>(span.x - offsetX, 0);
+			const int endX = MIN<int>(span.x + span.width - offsetX, scaledWidth);
+			for (int x = startX; x < endX; x++) {
+				const byte color = bitmap[x];
+				const int x2 = clipRectTranslated.left + x;
+				const int y2 = clipRectTranslated.top + y;
+				if (priority >= _screen->getPriority(x2, y2)) {
+					if (!_palette->isRemapped(palette->mapping[color])) {
+						_screen->putPixel(x2, y2, drawMask, palette->mapping[color], priority, 0);
+					} else {
+						byte remappedColor = _palette->remapColor(palette->mapping[color], _screen->getVisual(x2, y2));
+						_screen->putPixel(x2, y2, drawMask, remappedColor, priority, 0);
+					}
 				}
 			}
 		}
@@ -23,6 +23,9 @@
 #ifndef SCI_GRAPHICS_VIEW_H
 #define SCI_GRAPHICS_VIEW_H
 
+#include "common/array.h"
+#include "common/list.h"
+
 namespace Sci {
 
 enum Sci32ViewNativeResolution {
@@ -50,6 +53,33 @@ struct LoopInfo {
 	CelInfo *cel;
 };
 
+/**
+ * Run of opaque pixels within one row of a cel
+ */
+struct CelSpan {
+	int16 x;
+	int16 width;
+};
+
+/**
+ * A cel as it gets drawn, either at its original size or scaled. Holds the
+ *  runs of opaque pixels of every row, so that drawing can skip transparent
+ *  pixels. The runs of row y are spans[rowStart[y]] to spans[rowStart[y + 1] - 1]
+ */
+struct CachedCel {
+	int16 loopNo, celNo;
+	int16 scaleX, scaleY;
+	int16 width, height;
+	byte *scaledBitmap; // only set for scaled cels, otherwise the raw bitmap is used
+	Common::Array<uint32> rowStart;
+	Common::Array<CelSpan> spans;
+
+	CachedCel() : loopNo(0), celNo(0), scaleX(128), scaleY(128), width(0), height(0), scaledBitmap(0) {}
+	~CachedCel() { delete[] scaledBitmap; }
+
+	uint32 getSize() const;
+};
+
 #define SCI_VIEW_EGAMAPPING_SIZE 16
 #define SCI_VIEW_EGAMAPPING_COUNT 8
 
@@ -87,11 +117,20 @@ public:
 
 	byte getColorAtCoordinate(int16 loopNo, int16 celNo, int16 x, int16 y);
 
+	/**
+	 * Returns the amount of memory used by decoded and cached cels of this view.
+	 */
+	uint32 getCacheSize() const { return _cacheSize; }
+
 private:
 	void initData(GuiResourceId resourceId);
 	void unpackCel(int16 loopNo, int16 celNo, byte *outPtr, uint32 pixelCount);
 	void unditherBitmap(byte *bitmap, int16 width, int16 height, byte clearKey);
 
+	const CachedCel *getCachedCel(int16 loopNo, int16 celNo, int16 scaleX, int16 scaleY);
+	void createScaledBitmap(CachedCel *cachedCel, const byte *bitmap, int16 celWidth, int16 celHeight);
+	void purgeCelCache();
+
 	ResourceManager *_resMan;
 	GfxCoordAdjuster *_coordAdjuster;
 	GfxScreen *_screen;
@@ -118,6 +157,11 @@ private:
 	// this is not set for some views in laura bow 2 floppy and signals that the view shall never get scaled
 	//  even if scaleX/Y are set (inside kAnimate)
 	bool _isScaleable;
+
+	// recently drawn cels and scaled variants of them, most recently used first
+	Common::List<CachedCel *> _cachedCels;
+	// memory used by decoded bitmaps and cached cels
+	uint32 _cacheSize;
 };
 
 } // End of namespace Sci
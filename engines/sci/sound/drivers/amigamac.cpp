@@ -803,8 +803,7 @@ bool MidiDriver_AmigaMac::loadInstrumentsSCI0Mac(Common::SeekableReadStream &fil
 	instrumentOffsets.resize(_bank.size);
 	_bank.instruments.resize(_bank.size);
 
-	for (uint32 i = 0; i < _bank.size; i++)
-		instrumentOffsets[i] = file.readUint32BE();
+	file.readUint32BEArray(instrumentOffsets.begin(), _bank.size);
 
 	for (uint i = 0; i < _bank.size; i++) {
 		// 0 signifies it doesn't exist
@@ -898,8 +897,7 @@ bool MidiDriver_AmigaMac::loadInstrumentsSCI1(Common::SeekableReadStream &file)
 	instrumentOffsets.resize(_bank.size);
 	_bank.instruments.resize(_bank.size);
 
-	for (uint32 i = 0; i < _bank.size; i++)
-		instrumentOffsets[i] = file.readUint32BE();
+	file.readUint32BEArray(instrumentOffsets.begin(), _bank.size);
 
 	for (uint32 i = 0; i < _bank.size; i++) {
 		// 0 signifies it doesn't exist
@@ -339,6 +339,8 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeId = costume;
+
 	akhd = (const AkosHeader *) _vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	akof = (const AkosOffset *) _vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -539,12 +541,40 @@ byte AkosRenderer::drawLimb(const Actor *a, int limb) {
 	return result;
 }
 
+inline void AkosRenderer::codec1_drawPixel(byte *dst, byte color) {
+	uint16 pcolor = _palette[color];
+
+	if (_shadow_mode == 1) {
+		if (pcolor == 13)
+			pcolor = _shadow_table[*dst];
+	} else if (_shadow_mode == 2) {
+		error("codec1_spec2"); // TODO
+	} else if (_shadow_mode == 3) {
+		if (_vm->_game.features & GF_16BIT_COLOR) {
+			uint16 srcColor = (pcolor >> 1) & 0x7DEF;
+			uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
+			pcolor = srcColor + dstColor;
+		} else if (_vm->_game.heversion >= 90) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = xmap[pcolor];
+		} else if (pcolor < 8) {
+			pcolor = (pcolor << 8) + *dst;
+			pcolor = _shadow_table[pcolor];
+		}
+	}
+	if (_vm->_bytesPerPixel == 2) {
+		WRITE_UINT16(dst, pcolor);
+	} else {
+		*dst = pcolor;
+	}
+}
+
 void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
 	byte len, maskbit;
 	int y;
-	uint16 color, height, pcolor;
+	uint16 color, height;
 	const byte *scaleytab;
 	bool masked;
 	bool skip_column = false;
@@ -580,32 +610,8 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 				} else {
 					masked = (y < v1.boundsRect.top || y >= v1.boundsRect.bottom) || (v1.x < 0 || v1.x >= v1.boundsRect.right) || (*mask & maskbit);
 
-					if (color && !masked && !skip_column) {
-						pcolor = _palette[color];
-						if (_shadow_mode == 1) {
-							if (pcolor == 13)
-								pcolor = _shadow_table[*dst];
-						} else if (_shadow_mode == 2) {
-							error("codec1_spec2"); // TODO
-						} else if (_shadow_mode == 3) {
-							if (_vm->_game.features & GF_16BIT_COLOR) {
-								uint16 srcColor = (pcolor >> 1) & 0x7DEF;
-								uint16 dstColor = (READ_UINT16(dst) >> 1) & 0x7DEF;
-								pcolor = srcColor + dstColor;
-							} else if (_vm->_game.heversion >= 90) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = xmap[pcolor];
-							} else if (pcolor < 8) {
-								pcolor = (pcolor << 8) + *dst;
-								pcolor = _shadow_table[pcolor];
-							}
-						}
-						if (_vm->_bytesPerPixel == 2) {
-							WRITE_UINT16(dst, pcolor);
-						} else {
-							*dst = pcolor;
-						}
-					}
+					if (color && !masked && !skip_column)
+						codec1_drawPixel(dst, color);
 				}
 				dst += _out.pitch;
 				mask += _numStrips;
@@ -637,6 +643,67 @@ void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	} while (1);
 }
 
+void AkosRenderer::codec1_spans(Codec1 &v1, const CostumeFrameCache::Frame &frame) {
+	const byte *mask, *src;
+	byte *dst;
+	byte maskbit;
+	int y, row;
+	uint32 span, end;
+	int column = v1.startColumn;
+	bool skip_column = false;
+
+	// Rows dropped by scaling are the same for every column
+	const byte *scaleytab = &v1.scaletable[v1.scaleYindex];
+	_rowMap.resize(_height);
+	for (row = 0, y = 0; y < _height; y++) {
+		if (_scaleY == 255 || scaleytab[y] < _scaleY)
+			_rowMap[y] = row++;
+		else
+			_rowMap[y] = -1;
+	}
+
+	do {
+		if (!skip_column && v1.x >= 0 && v1.x < v1.boundsRect.right) {
+			maskbit = revBitMask(v1.x & 7);
+			mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), v1.y, _zbuf);
+
+			end = frame.columns[column + 1];
+			for (span = frame.columns[column]; span < end; span++) {
+				const CostumeFrameCache::Span &s = frame.spans[span];
+				src = frame.pixels + column * _height + s.start;
+
+				for (int i = s.start; i < s.start + s.length; i++, src++) {
+					row = _rowMap[i];
+					if (row < 0)
+						continue;
+					y = v1.y + row;
+					if (y < v1.boundsRect.top || y >= v1.boundsRect.bottom)
+						continue;
+					if (mask[row * _numStrips] & maskbit)
+						continue;
+
+					dst = v1.destptr + row * _out.pitch;
+					codec1_drawPixel(dst, *src);
+				}
+			}
+		}
+
+		if (!--v1.skip_width)
+			return;
+
+		if (_scaleX == 255 || v1.scaletable[v1.scaleXindex] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+				return;
+			v1.destptr += v1.scaleXstep * _vm->_bytesPerPixel;
+			skip_column = false;
+		} else
+			skip_column = true;
+		v1.scaleXindex += v1.scaleXstep;
+		column++;
+	} while (1);
+}
+
 // This is exact duplicate of smallCostumeScaleTable[] in costume.cpp
 // See FIXME below for explanation
 const byte smallCostumeScaleTableAKOS[256] = {
@@ -940,6 +1007,12 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 		return 0;
 
 	v1.replen = 0;
+	v1.startColumn = 0;
+
+	// Look up the decoded frame before codec1_ignorePakCols() moves _srcptr
+	const CostumeFrameCache::Frame *frame = 0;
+	if (!_actorHitMode)
+		frame = codec1_getFrame(_costumeId, _srcptr - akcd, v1);
 
 	if (_mirror) {
 		if (!use_scaling)
@@ -996,7 +1069,10 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.destptr = (byte *)_out.getBasePtr(v1.x, v1.y);
 
-	codec1_genericDecode(v1);
+	if (frame)
+		codec1_spans(v1, *frame);
+	else
+		codec1_genericDecode(v1);
 
 	return drawFlag;
 }
@@ -1145,7 +1221,21 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
-void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
+const CostumeFrameCache::Frame *AkosRenderer::akos16GetFrame() {
+	const uint32 offset = _srcptr - akcd;
+	const CostumeFrameCache::Frame *frame = _frameCache.find(_costumeId, offset, CostumeFrameCache::kFormatAkos16);
+	if (frame)
+		return frame;
+
+	CostumeFrameCache::Frame *newFrame = _frameCache.add(_costumeId, offset, CostumeFrameCache::kFormatAkos16, _width, _height);
+	if (newFrame) {
+		akos16SetupBitReader(_srcptr);
+		akos16DecodeLine(newFrame->pixels, _width * _height, 1);
+	}
+	return newFrame;
+}
+
+void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, const byte *decoded, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
 	byte *tmp_buf = _akos16.buffer;
 	int maskpitch;
@@ -1157,10 +1247,15 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
+	// Rows of a frame from the cache are copied instead of decoded
+	if (decoded) {
+		decoded += numskip_before;
+	} else {
+		akos16SetupBitReader(src);
 
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
+		if (numskip_before != 0) {
+			akos16SkipData(numskip_before);
+		}
 	}
 
 	maskpitch = _numStrips;
@@ -1170,12 +1265,18 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (decoded) {
+			for (int32 i = 0; i < t_width; i++)
+				tmp_buf[i * dir] = decoded[i];
+			decoded += t_width + numskip_after;
+		} else {
+			akos16DecodeLine(tmp_buf, t_width, dir);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
+		if (!decoded && numskip_after != 0) {
 			akos16SkipData(numskip_after);
 		}
 		dest += pitch;
@@ -1290,7 +1391,9 @@ byte AkosRenderer::codec16(int xmoveCur, int ymoveCur) {
 
 	byte *dst = (byte *)_out.getBasePtr(width_unk, height_unk);
 
-	akos16Decompress(dst, _out.pitch, _srcptr, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
+	const CostumeFrameCache::Frame *frame = akos16GetFrame();
+
+	akos16Decompress(dst, _out.pitch, _srcptr, frame ? frame->pixels : 0, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
 	return 0;
 }
 
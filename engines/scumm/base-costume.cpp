@@ -26,6 +26,105 @@
 
 namespace Scumm {
 
+CostumeFrameCache::CostumeFrameCache() : _size(0), _useCounter(0) {
+}
+
+CostumeFrameCache::~CostumeFrameCache() {
+	clear();
+}
+
+const CostumeFrameCache::Frame *CostumeFrameCache::find(uint16 costume, uint32 offset, byte format) {
+	FrameMap::iterator it = _frames.find(Key(costume, format, offset));
+	if (it == _frames.end())
+		return 0;
+
+	it->_value.lastUse = ++_useCounter;
+	return &it->_value;
+}
+
+CostumeFrameCache::Frame *CostumeFrameCache::add(uint16 costume, uint32 offset, byte format, int width, int height) {
+	uint32 size = width * height + (width + 1) * sizeof(uint32);
+	if (width <= 0 || height <= 0 || size > kMaxSize / 4)
+		return 0;
+
+	prune(size);
+
+	Frame &frame = _frames[Key(costume, format, offset)];
+	frame.width = width;
+	frame.height = height;
+	frame.pixels = (byte *)malloc(width * height);
+	frame.size = width * height;
+	frame.lastUse = ++_useCounter;
+	_size += frame.size;
+	return &frame;
+}
+
+void CostumeFrameCache::decodeCodec1(Frame &frame, const byte *src, byte mask, byte shr) {
+	const uint32 total = frame.width * frame.height;
+	uint32 pos = 0;
+
+	while (pos < total) {
+		byte len = *src++;
+		byte color = len >> shr;
+		len &= mask;
+		if (!len)
+			len = *src++;
+
+		// A zero length byte encodes a run of 256 pixels
+		uint32 count = len ? len : 256;
+		if (count > total - pos)
+			count = total - pos;
+		memset(frame.pixels + pos, color, count);
+		pos += count;
+	}
+
+	frame.columns.resize(frame.width + 1);
+	for (uint16 x = 0; x < frame.width; x++) {
+		const byte *column = frame.pixels + x * frame.height;
+		frame.columns[x] = frame.spans.size();
+
+		uint16 y = 0;
+		while (y < frame.height) {
+			if (!column[y]) {
+				y++;
+				continue;
+			}
+			Span span;
+			span.start = y;
+			while (y < frame.height && column[y])
+				y++;
+			span.length = y - span.start;
+			frame.spans.push_back(span);
+		}
+	}
+	frame.columns[frame.width] = frame.spans.size();
+
+	uint32 extra = frame.columns.size() * sizeof(uint32) + frame.spans.size() * sizeof(Span);
+	frame.size += extra;
+	_size += extra;
+}
+
+void CostumeFrameCache::clear() {
+	for (FrameMap::iterator it = _frames.begin(); it != _frames.end(); ++it)
+		free(it->_value.pixels);
+	_frames.clear();
+	_size = 0;
+}
+
+void CostumeFrameCache::prune(uint32 needed) {
+	while (!_frames.empty() && _size + needed > kMaxSize) {
+		FrameMap::iterator oldest = _frames.begin();
+		for (FrameMap::iterator it = _frames.begin(); it != _frames.end(); ++it) {
+			if (it->_value.lastUse < oldest->_value.lastUse)
+				oldest = it;
+		}
+
+		_size -= oldest->_value.size;
+		free(oldest->_value.pixels);
+		_frames.erase(oldest);
+	}
+}
+
 byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const Actor *a, bool drawToBackBuf) {
 	int i;
 	byte result = 0;
@@ -59,6 +158,7 @@ byte BaseCostumeRenderer::drawCostume(const VirtScreen &vs, int numStrips, const
 }
 
 void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
+	v1.startColumn = num;
 	num *= _height;
 
 	do {
@@ -76,6 +176,17 @@ void BaseCostumeRenderer::codec1_ignorePakCols(Codec1 &v1, int num) {
 	} while (1);
 }
 
+const CostumeFrameCache::Frame *BaseCostumeRenderer::codec1_getFrame(uint16 costume, uint32 offset, const Codec1 &v1) {
+	const CostumeFrameCache::Frame *frame = _frameCache.find(costume, offset, v1.shr);
+	if (frame)
+		return frame;
+
+	CostumeFrameCache::Frame *newFrame = _frameCache.add(costume, offset, v1.shr, _width, _height);
+	if (newFrame)
+		_frameCache.decodeCodec1(*newFrame, _srcptr, v1.mask, v1.shr);
+	return newFrame;
+}
+
 bool ScummEngine::isCostumeInUse(int cost) const {
 	int i;
 	Actor *a;
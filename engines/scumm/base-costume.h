@@ -24,6 +24,8 @@
 #define SCUMM_BASE_COSTUME_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "scumm/actor.h"		// for CostumeData
 
 namespace Scumm {
@@ -63,6 +65,96 @@ public:
 };
 
 
+/**
+ * Cache of decoded limb frames, shared by all actors drawn by a renderer.
+ * Frames hold the color codes of the costume data before palette lookup,
+ * so the same entry serves every palette, scale and shadow mode an actor
+ * is drawn with. Codec 1 frames are stored column by column together with
+ * the opaque spans of each column, which lets the renderers skip over
+ * transparent pixels without looking at them.
+ */
+class CostumeFrameCache {
+public:
+	enum {
+		kMaxSize = 2 * 1024 * 1024
+	};
+
+	/**
+	 * Frame formats used as part of the cache key. Codec 1 frames use the
+	 * color shift of their RLE data instead.
+	 */
+	enum {
+		kFormatAkos16 = 0xFF
+	};
+
+	struct Span {
+		uint16 start;
+		uint16 length;
+	};
+
+	struct Frame {
+		uint16 width, height;
+		byte *pixels;
+		Common::Array<Span> spans;
+		Common::Array<uint32> columns;	// first span of every column, plus an end marker
+		uint32 size;
+		uint32 lastUse;
+
+		Frame() : width(0), height(0), pixels(0), size(0), lastUse(0) {}
+	};
+
+	CostumeFrameCache();
+	~CostumeFrameCache();
+
+	/** Return the frame stored for the given costume data, or 0. */
+	const Frame *find(uint16 costume, uint32 offset, byte format);
+
+	/**
+	 * Allocate a width x height frame for the given costume data, evicting
+	 * the least recently used frames to make room. Returns 0 if the frame
+	 * is too large to be cached at all.
+	 */
+	Frame *add(uint16 costume, uint32 offset, byte format, int width, int height);
+
+	/** Decode a codec 1 RLE stream into a newly added column-major frame. */
+	void decodeCodec1(Frame &frame, const byte *src, byte mask, byte shr);
+
+	void clear();
+
+	uint32 getSize() const { return _size; }
+
+private:
+	struct Key {
+		uint16 costume;
+		byte format;
+		uint32 offset;
+
+		Key() : costume(0), format(0), offset(0) {}
+		Key(uint16 c, byte f, uint32 o) : costume(c), format(f), offset(o) {}
+	};
+
+	struct Key_Hash {
+		uint operator()(const Key &k) const {
+			return (k.offset << 8) ^ (k.costume << 2) ^ k.format;
+		}
+	};
+
+	struct Key_EqualTo {
+		bool operator()(const Key &a, const Key &b) const {
+			return a.offset == b.offset && a.costume == b.costume && a.format == b.format;
+		}
+	};
+
+	typedef Common::HashMap<Key, Frame, Key_Hash, Key_EqualTo> FrameMap;
+
+	FrameMap _frames;
+	uint32 _size;
+	uint32 _useCounter;
+
+	void prune(uint32 needed);
+};
+
+
 /**
  * Base class for both ClassicCostumeRenderer and AkosRenderer.
  */
@@ -105,6 +197,11 @@ protected:
 	// width and height of cel to decode
 	int _width, _height;
 
+	// decoded frames, and the output row of each source row of the frame
+	// being drawn (-1 if scaled away)
+	CostumeFrameCache _frameCache;
+	Common::Array<int> _rowMap;
+
 public:
 	struct Codec1 {
 		// Parameters for the original ("V1") costume codec.
@@ -122,6 +219,7 @@ public:
 		// These ones aren't accessed from ARM code.
 		Common::Rect boundsRect;
 		int scaleXindex, scaleYindex;
+		int startColumn;
 	};
 
 	BaseCostumeRenderer(ScummEngine *scumm) {
@@ -155,6 +253,7 @@ protected:
 	virtual byte drawLimb(const Actor *a, int limb) = 0;
 
 	void codec1_ignorePakCols(Codec1 &v1, int num);
+	const CostumeFrameCache::Frame *codec1_getFrame(uint16 costume, uint32 offset, const Codec1 &v1);
 };
 
 } // End of namespace Scumm
@@ -229,6 +229,15 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 		return 0;
 
 	v1.replen = 0;
+	v1.startColumn = 0;
+
+	// Look up the decoded frame before codec1_ignorePakCols() moves _srcptr.
+	// ARM builds keep drawing from the RLE data with their assembly renderer.
+	const CostumeFrameCache::Frame *frame = 0;
+#ifndef USE_ARM_COSTUME_ASM
+	if (!newAmiCost && !pcEngCost && _loaded._format != 0x57)
+		frame = codec1_getFrame(_loaded._id, _srcptr - _loaded._baseptr, v1);
+#endif
 
 	if (_mirror) {
 		if (!use_scaling)
@@ -305,6 +314,8 @@ byte ClassicCostumeRenderer::mainRoutine(int xmoveCur, int ymoveCur) {
 		proc3_ami(v1);
 	else if (pcEngCost)
 		procPCEngine(v1);
+	else if (frame)
+		proc3_spans(v1, *frame);
 	else
 		proc3(v1);
 
@@ -518,6 +529,72 @@ void ClassicCostumeRenderer::proc3(Codec1 &v1) {
 	} while (1);
 }
 
+void ClassicCostumeRenderer::proc3_spans(Codec1 &v1, const CostumeFrameCache::Frame &frame) {
+	const byte *mask, *src;
+	byte *dst;
+	byte maskbit;
+	int y, row;
+	uint pcolor;
+	uint32 span, end;
+	int column = v1.startColumn;
+
+	// Rows dropped by scaling are the same for every column
+	byte scaleIndexY = _scaleIndexY;
+	_rowMap.resize(_height);
+	for (row = 0, y = 0; y < _height; y++) {
+		if (_scaleY == 255 || v1.scaletable[scaleIndexY++] < _scaleY)
+			_rowMap[y] = row++;
+		else
+			_rowMap[y] = -1;
+	}
+
+	do {
+		if (v1.x >= 0 && v1.x < _out.w) {
+			maskbit = revBitMask(v1.x & 7);
+			mask = v1.mask_ptr + v1.x / 8;
+
+			end = frame.columns[column + 1];
+			for (span = frame.columns[column]; span < end; span++) {
+				const CostumeFrameCache::Span &s = frame.spans[span];
+				src = frame.pixels + column * _height + s.start;
+
+				for (int i = s.start; i < s.start + s.length; i++, src++) {
+					row = _rowMap[i];
+					if (row < 0)
+						continue;
+					y = v1.y + row;
+					if (y < 0 || y >= _out.h)
+						continue;
+					if (v1.mask_ptr && (mask[row * _numStrips] & maskbit))
+						continue;
+
+					dst = v1.destptr + row * _out.pitch;
+					if (_shadow_mode & 0x20) {
+						pcolor = _shadow_table[*dst];
+					} else {
+						pcolor = _palette[*src];
+						if (pcolor == 13 && _shadow_table)
+							pcolor = _shadow_table[*dst];
+					}
+					*dst = pcolor;
+				}
+			}
+		}
+
+		if (!--v1.skip_width)
+			return;
+
+		if (_scaleX == 255 || v1.scaletable[_scaleIndexX] < _scaleX) {
+			v1.x += v1.scaleXstep;
+			if (v1.x < 0 || v1.x >= _out.w)
+				return;
+			v1.destptr += v1.scaleXstep;
+		}
+		_scaleIndexX += v1.scaleXstep;
+		column++;
+	} while (1);
+}
+
 void ClassicCostumeRenderer::proc3_ami(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
@@ -29,6 +29,7 @@
 #include "scumm/actor.h"
 #include "scumm/boxes.h"
 #include "scumm/debugger.h"
+#include "scumm/gfx.h"
 #include "scumm/imuse/imuse.h"
 #include "scumm/object.h"
 #include "scumm/resource.h"
@@ -97,6 +98,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("imuse",     WRAP_METHOD(ScummDebugger, Cmd_IMuse));
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+	registerCmd("stripcache",      WRAP_METHOD(ScummDebugger, Cmd_StripCache));
 }
 
 ScummDebugger::~ScummDebugger() {
@@ -840,4 +842,20 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_StripCache(int argc, const char **argv) {
+	Gdi *gdi = _vm->_gdi;
+
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		gdi->flushStripCache();
+		gdi->_stripCacheHits = gdi->_stripCacheMisses = 0;
+	} else if (argc != 1) {
+		debugPrintf("Syntax: stripcache [reset]\n");
+		return true;
+	}
+
+	debugPrintf("Room strip cache: %u hits, %u misses, %u bytes used\n",
+	            gdi->_stripCacheHits, gdi->_stripCacheMisses, gdi->getStripCacheSize());
+	return true;
+}
+
 } // End of namespace Scumm
@@ -57,6 +57,8 @@ static void clear8Col(byte *dst, int dstPitch, int height, uint8 bitDepth);
 
 static void ditherHerc(byte *src, byte *hercbuf, int srcPitch, int *x, int *y, int *width, int *height);
 
+static bool isTextAreaTransparent(const byte *text, int textPitch, int width, int height);
+
 struct StripTable {
 	int offsets[160];
 	int run[160];
@@ -214,10 +216,18 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_vertStripNextInc = 0;
 	_zbufferDisabled = false;
 	_objectMode = false;
+	_cacheStrips = false;
+	_stripCacheImage = 0;
+	_stripCacheHeight = 0;
+	memset(_stripCachePalette, 0, sizeof(_stripCachePalette));
+	_stripCacheSize = 0;
+	_stripCacheHits = 0;
+	_stripCacheMisses = 0;
 	_distaff = false;
 }
 
 Gdi::~Gdi() {
+	flushStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
@@ -275,6 +285,7 @@ void Gdi::init() {
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	flushStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -653,6 +664,17 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 		assert(IS_ALIGNED(text, 4));
 		assert(0 == (width & 3));
 
+		// If no text covers this area and no rendering filter or special
+		// placement applies, the game graphics can be blitted as they are.
+		// This is the common case for room redraws while scrolling.
+		if (m == 1 && _outputPixelFormat.bytesPerPixel == 1 && vs->format.bytesPerPixel == 1 &&
+		    _game.platform != Common::kPlatformFMTowns && _game.platform != Common::kPlatformNES &&
+		    _renderMode != Common::kRenderCGA && _renderMode != Common::kRenderHercA && _renderMode != Common::kRenderHercG &&
+		    isTextAreaTransparent((const byte *)text, _textSurface.pitch, width, height)) {
+			_system->copyRectToScreen(src, pitch, x, y, width, height);
+			return;
+		}
+
 		// Compose the text over the game graphics
 #ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
 		if (_game.platform == Common::kPlatformFMTowns) {
@@ -1008,7 +1030,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbCacheStrips);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1174,6 +1196,21 @@ static void blit(byte *dst, int dstPitch, const byte *src, int srcPitch, int w,
 	}
 }
 
+static bool isTextAreaTransparent(const byte *text, int textPitch, int width, int height) {
+	// width is a multiple of 4 and text is 4 byte aligned, so the area can
+	// be checked four pixels at a time
+	for (; height > 0; --height) {
+		const uint32 *text32 = (const uint32 *)text;
+		for (int w = width; w > 0; w -= 4) {
+			if (*text32++ != CHARSET_MASK_TRANSPARENCY_32)
+				return false;
+		}
+		text += textPitch;
+	}
+
+	return true;
+}
+
 static void fill(byte *dst, int dstPitch, uint16 color, int w, int h, uint8 bitDepth) {
 	assert(h > 0);
 	assert(dst != NULL);
@@ -1793,6 +1830,9 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_vertStripNextInc = height * vs->pitch - 1 * vs->format.bytesPerPixel;
 
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
+	_cacheStrips = (flag & dbCacheStrips) && vs->format.bytesPerPixel == 1;
+	if (_cacheStrips)
+		validateStripCache(ptr, height);
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
 	sx = x - vs->xstart / 8;
@@ -1908,7 +1948,61 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 			_roomPalette = _vm->_roomPalette;
 	}
 
-	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+	if (!_cacheStrips || stripnr < 0)
+		return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+
+	if (stripnr < (int)_stripCache.size() && _stripCache[stripnr]) {
+		const byte *cached = _stripCache[stripnr];
+		for (int h = 0; h < height; h++) {
+			memcpy(dstPtr, cached, 8);
+			dstPtr += vs->pitch;
+			cached += 8;
+		}
+		_stripCacheHits++;
+		return false;
+	}
+
+	_stripCacheMisses++;
+	const bool transpStrip = decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
+
+	// Only opaque strips can be cached, as transparent ones depend on
+	// what was drawn below them
+	if (!transpStrip && _stripCacheSize + 8 * height <= kStripCacheMaxSize) {
+		if (stripnr >= (int)_stripCache.size())
+			_stripCache.resize(stripnr + 1);
+
+		byte *cached = (byte *)malloc(8 * height);
+		_stripCache[stripnr] = cached;
+		_stripCacheSize += 8 * height;
+
+		for (int h = 0; h < height; h++) {
+			memcpy(cached, dstPtr, 8);
+			dstPtr += vs->pitch;
+			cached += 8;
+		}
+	}
+
+	return transpStrip;
+}
+
+void Gdi::validateStripCache(const byte *ptr, int height) {
+	// Some decoders map colors through the room palette, which scripts can change
+	if (ptr == _stripCacheImage && height == _stripCacheHeight && !memcmp(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette)))
+		return;
+
+	flushStripCache();
+	_stripCacheImage = ptr;
+	_stripCacheHeight = height;
+	memcpy(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette));
+}
+
+void Gdi::flushStripCache() {
+	for (uint i = 0; i < _stripCache.size(); i++)
+		free(_stripCache[i]);
+
+	_stripCache.clear();
+	_stripCacheImage = 0;
+	_stripCacheSize = 0;
 }
 
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
@@ -23,6 +23,7 @@
 #ifndef SCUMM_GFX_H
 #define SCUMM_GFX_H
 
+#include "common/array.h"
 #include "common/system.h"
 #include "common/list.h"
 
@@ -197,6 +198,27 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true while the room background is being rendered. */
+	bool _cacheStrips;
+
+	/**
+	 * Decoded room background strips, indexed by strip number, so that
+	 * redrawing the room does not decompress the same strips again. The
+	 * cache is only valid for the room image, height and room palette it
+	 * was filled with, and is flushed as soon as any of those changes.
+	 */
+	Common::Array<byte *> _stripCache;
+	const byte *_stripCacheImage;
+	int _stripCacheHeight;
+	byte _stripCachePalette[256];
+	uint32 _stripCacheSize;
+
+	enum {
+		kStripCacheMaxSize = 1024 * 1024
+	};
+
+	void validateStripCache(const byte *ptr, int height);
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -267,10 +289,18 @@ public:
 
 	void resetBackground(int top, int bottom, int strip);
 
+	void flushStripCache();
+	uint32 getStripCacheSize() const { return _stripCacheSize; }
+
+	/** Room background strip cache statistics, shown by the debugger */
+	uint32 _stripCacheHits;
+	uint32 _stripCacheMisses;
+
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbCacheStrips   = 1 << 4
 	};
 };
 
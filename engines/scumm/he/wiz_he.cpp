@@ -645,11 +645,22 @@ void Wiz::copyRaw16BitWizImage(uint8 *dst, const uint8 *src, int dstPitch, int d
 		int w = r1.width();
 		src += (r1.top * srcw + r1.left) * 2;
 		dst += r2.top * dstPitch + r2.left * 2;
+
+		// Without a transparent color, rows are copied as they are whenever
+		// the destination uses the same byte order as the source
+		bool copyRows = (transColor == -1) && (dstType == kDstMemory || dstType == kDstResource);
+#ifdef SCUMM_LITTLE_ENDIAN
+		copyRows = copyRows || ((transColor == -1) && (dstType == kDstScreen || dstType == kDstCursor));
+#endif
 		while (h--) {
-			for (int i = 0; i < w; ++ i) {
-				uint16 col = READ_LE_UINT16(src + 2 * i);
-				if (transColor == -1 || transColor != col) {
-					writeColor(dst + i * 2, dstType, col);
+			if (copyRows) {
+				memcpy(dst, src, w * 2);
+			} else {
+				for (int i = 0; i < w; ++ i) {
+					uint16 col = READ_LE_UINT16(src + 2 * i);
+					if (transColor == -1 || transColor != col) {
+						writeColor(dst + i * 2, dstType, col);
+					}
 				}
 			}
 			src += srcw * 2;
@@ -770,9 +781,18 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (type == kWizCopy) {
+						// The whole run has a single color
+						uint16 col = READ_LE_UINT16(dataPtr);
+						while (code--) {
+							writeColor(dstPtr, dstType, col);
+							dstPtr += dstInc;
+						}
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -904,9 +924,21 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (type != kWizXMap && bitDepth == 1 && dstInc == 1) {
+						// The whole run has a single color
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else if (type != kWizXMap && bitDepth == 2) {
+						uint16 col = (type == kWizRMap) ? READ_LE_UINT16(palPtr + *dataPtr * 2) : *dataPtr;
+						while (code--) {
+							writeColor(dstPtr, dstType, col);
+							dstPtr += dstInc;
+						}
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -924,10 +956,16 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (type == kWizCopy && bitDepth == 1 && dstInc == 1) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -952,6 +990,21 @@ void Wiz::decompressRawWizImage(uint8 *dst, int dstPitch, int dstType, const uin
 		return;
 	}
 	while (h--) {
+		if (type == kWizCopy && bitDepth == 1) {
+			// Copy the spans between transparent pixels at once
+			int i = 0;
+			while (i < w) {
+				while (i < w && src[i] == transColor)
+					++i;
+				int start = i;
+				while (i < w && src[i] != transColor)
+					++i;
+				memcpy(dst + start, src + start, i - start);
+			}
+			src += srcPitch;
+			dst += dstPitch;
+			continue;
+		}
 		for (int i = 0; i < w; ++i) {
 			uint8 col = src[i];
 			if (transColor == -1 || transColor != col) {
@@ -1971,20 +2024,28 @@ void Wiz::drawWizPolygonImage(uint8 *dst, const uint8 *src, const uint8 *mask, i
 		int32 w = pra->w;
 		int32 x_acc = pra->x_s;
 		int32 y_acc = pra->y_s;
-		while (--w) {
-			int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
-			assert(src_offs < wizW * wizH);
-			x_acc += pra->x_step;
-			y_acc += pra->y_step;
-			if (bitDepth == 2) {
-				if (transColor == -1 || transColor != READ_LE_UINT16(src + src_offs * 2)) {
-					writeColor(dstPtr, dstType, READ_LE_UINT16(src + src_offs * 2));
+		if (bitDepth == 2) {
+			while (--w) {
+				int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
+				assert(src_offs < wizW * wizH);
+				x_acc += pra->x_step;
+				y_acc += pra->y_step;
+				uint16 col = READ_LE_UINT16(src + src_offs * 2);
+				if (transColor == -1 || transColor != col) {
+					writeColor(dstPtr, dstType, col);
 				}
-			} else {
+				dstPtr += 2;
+			}
+		} else {
+			while (--w) {
+				int32 src_offs = (y_acc >> 16) * wizW + (x_acc >> 16);
+				assert(src_offs < wizW * wizH);
+				x_acc += pra->x_step;
+				y_acc += pra->y_step;
 				if (transColor == -1 || transColor != src[src_offs])
 					*dstPtr = src[src_offs];
+				dstPtr++;
 			}
-			dstPtr += bitDepth;
 		}
 	}
 
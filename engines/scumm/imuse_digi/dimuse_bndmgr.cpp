@@ -44,6 +44,9 @@ BundleDirCache::~BundleDirCache() {
 	for (int fileId = 0; fileId < ARRAYSIZE(_budleDirCache); fileId++) {
 		free(_budleDirCache[fileId].bundleTable);
 		free(_budleDirCache[fileId].indexTable);
+		BlockList &blocks = _budleDirCache[fileId].blocks;
+		for (BlockList::iterator it = blocks.begin(); it != blocks.end(); ++it)
+			delete *it;
 	}
 }
 
@@ -63,6 +66,39 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _budleDirCache[slot].isCompressed;
 }
 
+BundleDirCache::DecompressedBlock *BundleDirCache::findBlock(int slot, int32 index, int32 block) {
+	BlockList &blocks = _budleDirCache[slot].blocks;
+	for (BlockList::iterator it = blocks.begin(); it != blocks.end(); ++it) {
+		DecompressedBlock *entry = *it;
+		if (entry->index == index && entry->block == block) {
+			// Move it to the front, to keep the list in LRU order
+			if (it != blocks.begin()) {
+				blocks.erase(it);
+				blocks.push_front(entry);
+			}
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+BundleDirCache::DecompressedBlock *BundleDirCache::allocBlock(int slot) {
+	BlockList &blocks = _budleDirCache[slot].blocks;
+	DecompressedBlock *entry;
+	if (blocks.size() < BUNDLE_MAX_CACHED_BLOCKS) {
+		entry = new DecompressedBlock();
+	} else {
+		// Reuse the least recently used block
+		entry = blocks.back();
+		blocks.pop_back();
+	}
+	entry->index = -1;
+	entry->block = -1;
+	entry->size = 0;
+	blocks.push_front(entry);
+	return entry;
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -147,6 +183,7 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_numCompItems = 0;
 	_curSampleId = -1;
 	_fileBundleId = -1;
+	_slot = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
 }
@@ -184,17 +221,15 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 		return false;
 	}
 
-	int slot = _cache->matchFile(filename);
-	assert(slot != -1);
-	compressed = _cache->isSndDataExtComp(slot);
-	_numFiles = _cache->getNumFiles(slot);
+	_slot = _cache->matchFile(filename);
+	assert(_slot != -1);
+	compressed = _cache->isSndDataExtComp(_slot);
+	_numFiles = _cache->getNumFiles(_slot);
 	assert(_numFiles);
-	_bundleTable = _cache->getTable(slot);
-	_indexTable = _cache->getIndexTable(slot);
+	_bundleTable = _cache->getTable(_slot);
+	_indexTable = _cache->getIndexTable(_slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
 
 	return true;
 }
@@ -206,8 +241,7 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
+		_slot = -1;
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = NULL;
@@ -240,12 +274,47 @@ bool BundleMgr::loadCompTable(int32 index) {
 			maxSize = _compTable[i].size;
 	}
 	// CMI hack: one more byte at the end of input buffer
-	_compInputBuff = (byte *)malloc(maxSize + 1);
+	_compInputBuff = (byte *)malloc(maxSize * BUNDLE_READ_AHEAD_BLOCKS + 1);
 	assert(_compInputBuff);
 
 	return true;
 }
 
+void BundleMgr::readCompBlocks(int32 index, int32 firstBlock) {
+	// Streamed sounds request the following blocks next. Read those that
+	// are stored right after this one with the same seek and read.
+	int32 lastBlock = firstBlock;
+	int32 inputSize = _compTable[firstBlock].size;
+	while (lastBlock + 1 < _numCompItems && lastBlock + 1 - firstBlock < BUNDLE_READ_AHEAD_BLOCKS &&
+			_compTable[lastBlock + 1].offset == _compTable[lastBlock].offset + _compTable[lastBlock].size &&
+			!_cache->findBlock(_slot, index, lastBlock + 1)) {
+		lastBlock++;
+		inputSize += _compTable[lastBlock].size;
+	}
+
+	_file->seek(_bundleTable[index].offset + _compTable[firstBlock].offset, SEEK_SET);
+	_file->read(_compInputBuff, inputSize);
+
+	byte *input = _compInputBuff;
+	for (int32 i = firstBlock; i <= lastBlock; i++) {
+		// CMI hack: one more zero byte at the end of input buffer
+		byte *inputEnd = input + _compTable[i].size;
+		byte next = *inputEnd;
+		*inputEnd = 0;
+
+		BundleDirCache::DecompressedBlock *block = _cache->allocBlock(_slot);
+		block->size = BundleCodecs::decompressCodec(_compTable[i].codec, input, block->data, _compTable[i].size);
+		if (block->size > 0x2000) {
+			error("_outputSize: %d", block->size);
+		}
+		block->index = index;
+		block->block = i;
+
+		*inputEnd = next;
+		input = inputEnd;
+	}
+}
+
 int32 BundleMgr::decompressSampleByCurIndex(int32 offset, int32 size, byte **compFinal, int headerSize, bool headerOutside) {
 	return decompressSampleByIndex(_curSampleId, offset, size, compFinal, headerSize, headerOutside);
 }
@@ -287,19 +356,15 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
+		// Blocks are shared between all sounds streamed from the same bundle
+		BundleDirCache::DecompressedBlock *block = _cache->findBlock(_slot, index, i);
+		if (!block) {
+			readCompBlocks(index, i);
+			block = _cache->findBlock(_slot, index, i);
+			assert(block);
 		}
 
-		outputSize = _outputSize;
+		outputSize = block->size;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -316,7 +381,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
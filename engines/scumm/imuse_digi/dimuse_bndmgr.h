@@ -25,11 +25,17 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/list.h"
 
 namespace Scumm {
 
 class BaseScummFile;
 
+// Number of decompressed blocks kept per bundle file
+#define BUNDLE_MAX_CACHED_BLOCKS 32
+// Number of consecutive blocks read and decompressed at once
+#define BUNDLE_READ_AHEAD_BLOCKS 4
+
 class BundleDirCache {
 public:
 	struct AudioTable {
@@ -43,14 +49,24 @@ public:
 		int32 index;
 	};
 
+	struct DecompressedBlock {
+		int32 index;
+		int32 block;
+		int32 size;
+		byte data[0x2000];
+	};
+
 private:
 
+	typedef Common::List<DecompressedBlock *> BlockList;
+
 	struct FileDirCache {
 		char fileName[20];
 		AudioTable *bundleTable;
 		int32 numFiles;
 		bool isCompressed;
 		IndexNode *indexTable;
+		BlockList blocks;	// most recently used first
 	} _budleDirCache[4];
 
 public:
@@ -62,6 +78,8 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+	DecompressedBlock *findBlock(int slot, int32 index, int32 block);
+	DecompressedBlock *allocBlock(int slot);
 };
 
 class BundleMgr {
@@ -85,12 +103,11 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
+	int _slot;
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
 
 	bool loadCompTable(int32 index);
+	void readCompBlocks(int32 index, int32 firstBlock);
 
 public:
 
@@ -220,6 +220,74 @@ bool ScummEngine::saveState(int slot, bool compat, Common::String &filename) {
 	return !saveFailed;
 }
 
+bool ScummEngine::startPendingSave(int slot, Common::String &filename) {
+	if (!finishPendingSave())
+		return false;
+
+	pauseEngine(true);
+
+	// Serialize the state into memory first, this is fast compared to
+	// compressing it and writing it out.
+	Common::MemoryWriteStreamDynamic memStream(DisposeAfterUse::NO);
+	bool success = saveState(&memStream);
+
+	pauseEngine(false);
+
+	// Write into a temporary file, which replaces the real savegame only
+	// once it is complete. Otherwise quitting before the last chunk is
+	// written would destroy the previous autosave.
+	filename = makeSavegameName(slot, false);
+	if (success) {
+		_pendingSaveFile = _saveFileMan->openForSaving(filename + ".tmp");
+		success = (_pendingSaveFile != 0);
+	}
+
+	if (!success) {
+		free(memStream.getData());
+		debug(1, "State save as '%s' FAILED", filename.c_str());
+		return false;
+	}
+
+	_pendingSaveData = memStream.getData();
+	_pendingSaveSize = memStream.size();
+	_pendingSavePos = 0;
+	_pendingSaveFileName = filename;
+	return true;
+}
+
+bool ScummEngine::writePendingSave(uint32 maxBytes) {
+	if (!_pendingSaveData)
+		return true;
+
+	const uint32 len = MIN(maxBytes, _pendingSaveSize - _pendingSavePos);
+	bool success = (_pendingSaveFile->write(_pendingSaveData + _pendingSavePos, len) == len);
+	_pendingSavePos += len;
+
+	if (success && _pendingSavePos < _pendingSaveSize)
+		return true;
+
+	_pendingSaveFile->finalize();
+	if (_pendingSaveFile->err())
+		success = false;
+	delete _pendingSaveFile;
+	_pendingSaveFile = 0;
+
+	free(_pendingSaveData);
+	_pendingSaveData = 0;
+
+	const Common::String tempFileName = _pendingSaveFileName + ".tmp";
+	if (success)
+		success = _saveFileMan->renameSavefile(tempFileName, _pendingSaveFileName);
+	if (!success)
+		_saveFileMan->removeSavefile(tempFileName);
+
+	if (success)
+		debug(1, "State saved as '%s'", _pendingSaveFileName.c_str());
+	else
+		debug(1, "State save as '%s' FAILED", _pendingSaveFileName.c_str());
+
+	return success;
+}
 
 void ScummEngine_v4::prepareSavegame() {
 	Common::MemoryWriteStreamDynamic *memStream;
@@ -217,6 +217,10 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_saveLoadSlot = 0;
 	_lastSaveTime = 0;
 	_saveTemporaryState = false;
+	_pendingSaveData = 0;
+	_pendingSaveSize = 0;
+	_pendingSavePos = 0;
+	_pendingSaveFile = 0;
 	memset(_localScriptOffsets, 0, sizeof(_localScriptOffsets));
 	_scriptPointer = NULL;
 	_scriptOrgPointer = NULL;
@@ -585,6 +589,9 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 
 ScummEngine::~ScummEngine() {
+	if (!finishPendingSave())
+		warning("Failed to write autosave '%s'", _pendingSaveFileName.c_str());
+
 	DebugMan.clearAllDebugChannels();
 
 	delete _musicEngine;
@@ -2347,6 +2354,11 @@ void ScummEngine::scummLoop_updateScummVars() {
 }
 
 void ScummEngine::scummLoop_handleSaveLoad() {
+	// Write the next part of a pending autosave. Finish it right away if
+	// another save or load is about to happen.
+	if (_pendingSaveData && !writePendingSave(_saveLoadFlag ? 0xFFFFFFFF : kPendingSaveChunkSize))
+		displayMessage(0, _("Failed to save game state to file:\n\n%s"), _pendingSaveFileName.c_str());
+
 	if (_saveLoadFlag) {
 		bool success;
 		const char *errMsg = 0;
@@ -2355,7 +2367,11 @@ void ScummEngine::scummLoop_handleSaveLoad() {
 			VAR(VAR_GAME_LOADED) = 0;
 
 		Common::String filename;
-		if (_saveLoadFlag == 1) {
+		if (_saveLoadFlag == 1 && _saveLoadSlot == 0 && !_saveTemporaryState) {
+			success = startPendingSave(_saveLoadSlot, filename);
+			if (!success)
+				errMsg = _("Failed to save game state to file:\n\n%s");
+		} else if (_saveLoadFlag == 1) {
 			success = saveState(_saveLoadSlot, _saveTemporaryState, filename);
 			if (!success)
 				errMsg = _("Failed to save game state to file:\n\n%s");
@@ -2600,6 +2616,11 @@ void ScummEngine::startManiac() {
 
 void ScummEngine::pauseEngineIntern(bool pause) {
 	if (pause) {
+		// Make sure a pending autosave is complete, e.g. before the
+		// save/load dialog lists the saves.
+		if (!finishPendingSave())
+			warning("Failed to write autosave '%s'", _pendingSaveFileName.c_str());
+
 		// Pause sound & video
 		_oldSoundsPaused = _sound->_soundsPaused;
 		_sound->pauseSounds(true);
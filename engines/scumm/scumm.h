@@ -104,6 +104,9 @@ enum {
 	NUM_SHADOW_PALETTE = 8
 };
 
+/** Number of bytes of a pending autosave written per scummLoop iteration. */
+static const uint32 kPendingSaveChunkSize = 65536;
+
 /**
  * SCUMM feature flags define for every game which specific set of engine
  * features are used by that game.
@@ -596,8 +599,22 @@ protected:
 	Common::String _saveLoadFileName;
 	Common::String _saveLoadDescription;
 
+	/**
+	 * Autosaves are first serialized into memory. The snapshot is then
+	 * compressed and written to a temporary file a chunk per scummLoop
+	 * iteration, so the game does not stall while the save is written.
+	 * The temporary file is renamed to the savegame once it is complete.
+	 */
+	byte *_pendingSaveData;
+	uint32 _pendingSaveSize, _pendingSavePos;
+	Common::WriteStream *_pendingSaveFile;
+	Common::String _pendingSaveFileName;
+
 	bool saveState(Common::WriteStream *out, bool writeHeader = true);
 	bool saveState(int slot, bool compat, Common::String &fileName);
+	bool startPendingSave(int slot, Common::String &fileName);
+	bool writePendingSave(uint32 maxBytes);
+	bool finishPendingSave() { return writePendingSave(0xFFFFFFFF); }
 	bool loadState(int slot, bool compat);
 	bool loadState(int slot, bool compat, Common::String &fileName);
 	virtual void saveOrLoad(Serializer *s);
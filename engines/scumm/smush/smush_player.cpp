@@ -689,9 +689,7 @@ void SmushPlayer::handleDeltaPalette(int32 subSize, Common::SeekableReadStream &
 		b.readUint16LE();
 		b.readUint16LE();
 
-		for (int i = 0; i < 0x300; i++) {
-			_deltaPal[i] = b.readUint16LE();
-		}
+		b.readUint16LEArray((uint16 *)_deltaPal, 0x300);
 		readPalette(_pal, b);
 		setDirtyColors(0, 255);
 	} else if (subSize == 6) {
@@ -478,7 +478,7 @@ static int compareMP3OffsetTable(const void *a, const void *b) {
 }
 
 void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle *handle) {
-	int num = 0, i;
+	int num = 0;
 	int id = -1;
 #if defined(USE_FLAC) || defined(USE_VORBIS) || defined(USE_MAD)
 	int size = 0;
@@ -596,8 +596,7 @@ void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle
 		file->seek(offset, SEEK_SET);
 
 		assert(num + 1 < (int)ARRAYSIZE(_mouthSyncTimes));
-		for (i = 0; i < num; i++)
-			_mouthSyncTimes[i] = file->readUint16BE();
+		file->readUint16BEArray(_mouthSyncTimes, num);
 
 		// Adjust offset to account for the mouth sync times. It is noteworthy
 		// that we do not adjust the size here for compressed streams, since
@@ -608,7 +607,7 @@ void Sound::startTalkSound(uint32 offset, uint32 b, int mode, Audio::SoundHandle
 		//if (_soundMode == kVOCMode)
 		//	size -= num * 2;
 
-		_mouthSyncTimes[i] = 0xFFFF;
+		_mouthSyncTimes[num] = 0xFFFF;
 		_sfxMode |= mode;
 		_curSoundPos = 0;
 		_mouthSyncMode = true;
@@ -34,10 +34,22 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_sourceIndices = new uint32[numRows * numColumns];
+	resetLookupTable();
 }
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _sourceIndices;
+}
+
+void RenderTable::resetLookupTable() {
+	uint32 count = _numRows * _numColumns;
+
+	for (uint32 i = 0; i < count; ++i) {
+		_internalBuffer[i] = Common::Point(0, 0);
+		_sourceIndices[i] = i;
+	}
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -99,46 +111,40 @@ uint16 mixTwoRGB(uint16 colorOne, uint16 colorTwo, float percentColorOne) {
 	return returnColor;
 }
 
-void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
-
-	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+static inline void mutateRow(const uint16 *sourceBuffer, uint16 *dest, const uint32 *indices, uint32 width) {
+	// Unrolled so the independent loads can be issued back to back
+	uint32 x = 0;
+	for (; x + 4 <= width; x += 4) {
+		uint16 p0 = sourceBuffer[indices[x + 0]];
+		uint16 p1 = sourceBuffer[indices[x + 1]];
+		uint16 p2 = sourceBuffer[indices[x + 2]];
+		uint16 p3 = sourceBuffer[indices[x + 3]];
+		dest[x + 0] = p0;
+		dest[x + 1] = p1;
+		dest[x + 2] = p2;
+		dest[x + 3] = p3;
+	}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+	for (; x < width; ++x)
+		dest[x] = sourceBuffer[indices[x]];
+}
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
+void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
+	uint32 width = subRect.width();
 
-		destOffset += destWidth;
+	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
+		mutateRow(sourceBuffer, destBuffer, &_sourceIndices[y * _numColumns + subRect.left], width);
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
-		}
+		mutateRow(sourceBuffer, destBuffer, &_sourceIndices[y * _numColumns], srcBuf->w);
+		destBuffer += srcBuf->w;
 	}
 }
 
@@ -157,8 +163,6 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
-
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -186,6 +190,7 @@ void RenderTable::generatePanoramaLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndices[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -221,6 +226,7 @@ void RenderTable::generateTiltLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndices[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
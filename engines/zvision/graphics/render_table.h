@@ -43,6 +43,12 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	/**
+	 * Absolute source pixel index for every destination pixel, kept in sync
+	 * with _internalBuffer so mutateImage() only has to do a single load per
+	 * pixel instead of rebuilding the index from the stored offsets.
+	 */
+	uint32 *_sourceIndices;
 	RenderState _renderState;
 
 	struct {
@@ -90,6 +96,7 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void resetLookupTable();
 };
 
 } // End of namespace ZVision
@@ -23,6 +23,7 @@
 #include "gui/saveload-dialog.h"
 #include "common/translation.h"
 #include "common/config-manager.h"
+#include "common/system.h"
 
 #include "gui/message.h"
 #include "gui/gui-manager.h"
@@ -96,6 +97,21 @@ void SaveLoadChooserDialog::open() {
 	setResult(-1);
 }
 
+void SaveLoadChooserDialog::close() {
+	// Saves may change while the dialog is not shown.
+	_metaInfoCache.clear();
+
+	Dialog::close();
+}
+
+const SaveStateDescriptor &SaveLoadChooserDialog::getSaveMetaInfos(int slot) {
+	MetaInfoCache::iterator i = _metaInfoCache.find(slot);
+	if (i != _metaInfoCache.end())
+		return i->_value;
+
+	return _metaInfoCache[slot] = _metaEngine->querySaveMetaInfos(_target.c_str(), slot);
+}
+
 int SaveLoadChooserDialog::run(const Common::String &target, const MetaEngine *metaEngine) {
 	_metaEngine = metaEngine;
 	_target = target;
@@ -276,6 +292,7 @@ void SaveLoadChooserSimple::handleCommand(CommandSender *sender, uint32 cmd, uin
 								_("Delete"), _("Cancel"));
 			if (alert.runModal() == kMessageOK) {
 				_metaEngine->removeSaveState(_target.c_str(), _saveList[selItem].getSaveSlot());
+				removeSaveMetaInfos(_saveList[selItem].getSaveSlot());
 
 				setResult(-1);
 				_list->setSelected(-1);
@@ -362,7 +379,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot());
+		const SaveStateDescriptor &desc = getSaveMetaInfos(_saveList[selItem].getSaveSlot());
 
 		isDeletable = desc.getDeletableFlag() && _delSupport;
 		isWriteProtected = desc.getWriteProtectedFlag();
@@ -538,7 +555,7 @@ enum {
 
 SaveLoadChooserGrid::SaveLoadChooserGrid(const Common::String &title, bool saveMode)
 	: SaveLoadChooserDialog("SaveLoadChooser", saveMode), _lines(0), _columns(0), _entriesPerPage(0),
-	_curPage(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons() {
+	_curPage(0), _nextMetaInfoEntry(0), _metaInfoEntriesEnd(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons() {
 	_backgroundType = ThemeEngine::kDialogBackgroundSpecial;
 
 	new StaticTextWidget(this, "SaveLoadChooser.Title", title);
@@ -619,6 +636,30 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 	}
 }
 
+void SaveLoadChooserGrid::handleTickle() {
+	// Load the meta infos of the visible slots incrementally, so the dialog
+	// stays responsive even if querying a save is slow.
+	const uint32 maxLoadTime = 20;
+	const uint32 startTime = g_system->getMillis();
+	const uint firstEntry = _curPage * _entriesPerPage;
+
+	while (_nextMetaInfoEntry < _metaInfoEntriesEnd) {
+		const uint entry = _nextMetaInfoEntry++;
+		const int saveSlot = _saveList[entry].getSaveSlot();
+		if (hasSaveMetaInfos(saveSlot))
+			continue;
+
+		SlotButton &curButton = _buttons[entry - firstEntry];
+		updateSlotButton(curButton, saveSlot, getSaveMetaInfos(saveSlot));
+		curButton.container->draw();
+
+		if (g_system->getMillis() - startTime >= maxLoadTime)
+			break;
+	}
+
+	SaveLoadChooserDialog::handleTickle();
+}
+
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
@@ -787,6 +828,8 @@ void SaveLoadChooserGrid::close() {
 		ConfMan.setInt("gui_saveload_last_pos", !_saveList.empty() ? _saveList[_curPage * _entriesPerPage].getSaveSlot() : 0);
 	}
 
+	_nextMetaInfoEntry = _metaInfoEntriesEnd = 0;
+
 	SaveLoadChooserDialog::close();
 	hideButtons();
 }
@@ -851,54 +894,26 @@ void SaveLoadChooserGrid::hideButtons() {
 void SaveLoadChooserGrid::updateSaves() {
 	hideButtons();
 
-	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
+	_nextMetaInfoEntry = _curPage * _entriesPerPage;
+	_metaInfoEntriesEnd = MIN<uint>(_saveList.size(), _nextMetaInfoEntry + _entriesPerPage);
 
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+	for (uint i = _nextMetaInfoEntry, curNum = 0; i < _metaInfoEntriesEnd; ++i, ++curNum) {
+		const int saveSlot = _saveList[i].getSaveSlot();
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
-
-		Common::String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
-
-		if (_saveDateSupport) {
-			const Common::String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += "\n";
-				tooltip +=  _("Date: ") + saveDate;
-			}
-
-			const Common::String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Time: ") + saveTime;
-			}
-		}
 
-		if (_playTimeSupport) {
-			const Common::String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Playtime: ") + playTime;
-			}
+		if (hasSaveMetaInfos(saveSlot)) {
+			updateSlotButton(curButton, saveSlot, getSaveMetaInfos(saveSlot));
+			continue;
 		}
 
-		curButton.button->setTooltip(tooltip);
-
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		if (_saveMode && desc.getWriteProtectedFlag()) {
-			curButton.button->setEnabled(false);
-		} else {
-			curButton.button->setEnabled(true);
-		}
+		// Show what the save list already tells us until handleTickle
+		// loaded the meta infos.
+		curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, _saveList[i].getDescription().c_str()));
+		curButton.button->setTooltip(_("Name: ") + _saveList[i].getDescription());
+		// We do not know yet whether the save is write protected.
+		curButton.button->setEnabled(!_saveMode);
 	}
 
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
@@ -915,6 +930,51 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSlotButton(SlotButton &button, int saveSlot, const SaveStateDescriptor &desc) {
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		button.button->setGfx(thumbnail);
+	} else {
+		button.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	button.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
+
+	Common::String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += "\n";
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	button.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected.
+	// TODO: Maybe we should not display it at all then?
+	if (_saveMode && desc.getWriteProtectedFlag()) {
+		button.button->setEnabled(false);
+	} else {
+		button.button->setEnabled(true);
+	}
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
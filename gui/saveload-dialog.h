@@ -28,6 +28,8 @@
 
 #include "engines/metaengine.h"
 
+#include "common/hashmap.h"
+
 namespace GUI {
 
 #define kSwitchSaveLoadDialog -2
@@ -55,6 +57,7 @@ public:
 	SaveLoadChooserDialog(int x, int y, int w, int h, const bool saveMode);
 
 	virtual void open();
+	virtual void close();
 
 	virtual void reflowLayout();
 
@@ -79,6 +82,15 @@ protected:
 	bool					_playTimeSupport;
 	Common::String			_target;
 
+	/**
+	 * Query the meta infos of a save slot. The result is cached until the
+	 * dialog is closed, so that looking at a slot again does not reopen
+	 * and decompress the save file.
+	 */
+	const SaveStateDescriptor &getSaveMetaInfos(int slot);
+	bool hasSaveMetaInfos(int slot) const { return _metaInfoCache.contains(slot); }
+	void removeSaveMetaInfos(int slot) { _metaInfoCache.erase(slot); }
+
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	ButtonWidget *_listButton;
 	ButtonWidget *_gridButton;
@@ -86,6 +98,10 @@ protected:
 	void addChooserButtons();
 	ButtonWidget *createSwitchButton(const Common::String &name, const char *desc, const char *tooltip, const char *image, uint32 cmd = 0);
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
+
+private:
+	typedef Common::HashMap<int, SaveStateDescriptor> MetaInfoCache;
+	MetaInfoCache _metaInfoCache;
 };
 
 class SaveLoadChooserSimple : public SaveLoadChooserDialog {
@@ -164,6 +180,7 @@ public:
 protected:
 	virtual void handleCommand(CommandSender *sender, uint32 cmd, uint32 data);
 	virtual void handleMouseWheel(int x, int y, int direction);
+	virtual void handleTickle();
 private:
 	virtual int runIntern();
 
@@ -172,6 +189,12 @@ private:
 	uint _curPage;
 	SaveStateList _saveList;
 
+	/**
+	 * Range of _saveList entries on the current page whose meta infos still
+	 * need to be loaded. They are loaded a few at a time in handleTickle.
+	 */
+	uint _nextMetaInfoEntry, _metaInfoEntriesEnd;
+
 	ButtonWidget *_nextButton;
 	ButtonWidget *_prevButton;
 
@@ -201,6 +224,7 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+	void updateSlotButton(SlotButton &button, int saveSlot, const SaveStateDescriptor &desc);
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
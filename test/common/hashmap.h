@@ -1,10 +1,15 @@
 #include <cxxtest/TestSuite.h>
 
 #include "common/hashmap.h"
+#include "common/flat-hashmap.h"
 #include "common/hash-str.h"
 
 class HashMapTestSuite : public CxxTest::TestSuite
 {
+	struct ConstantHash {
+		uint operator()(int) const { return 7; }
+	};
+
 	public:
 	void test_empty_clear() {
 		Common::HashMap<int, int> container;
@@ -230,5 +235,114 @@ class HashMapTestSuite : public CxxTest::TestSuite
 		TS_ASSERT(found == 16+8+4);
 }
 
+	void test_reuse_erased() {
+		// All keys share one probe sequence, so inserting has to look past
+		// the erased entries and may then reuse the first of them.
+		Common::HashMap<int, int, ConstantHash> container;
+		for (int i = 1; i <= 4; ++i)
+			container[i] = i * 10;
+		container.erase(1);
+		container.erase(2);
+		container[5] = 50;
+		// Key 5 takes over the entry of key 1, the first one in the table.
+		TS_ASSERT_EQUALS(container.begin()->_key, 5);
+		container[3] = 31;
+		container[1] = 11;
+		TS_ASSERT_EQUALS(container.size(), 4u);
+		TS_ASSERT(!container.contains(2));
+		TS_ASSERT_EQUALS(container.getVal(1, 0), 11);
+		TS_ASSERT_EQUALS(container.getVal(3, 0), 31);
+		TS_ASSERT_EQUALS(container.getVal(4, 0), 40);
+		TS_ASSERT_EQUALS(container.getVal(5, 0), 50);
+
+		int sum = 0;
+		Common::HashMap<int, int, ConstantHash>::const_iterator i;
+		for (i = container.begin(); i != container.end(); ++i)
+			sum += i->_value;
+		TS_ASSERT_EQUALS(sum, 11 + 31 + 40 + 50);
+	}
+
+	void test_flat_collision() {
+		// With a constant hash function all keys start probing at the same
+		// entry, so erasing has to move the following ones back.
+		Common::FlatHashMap<int, int, ConstantHash> h;
+		for (int i = 1; i <= 5; ++i)
+			h[i] = i * 10;
+		h.erase(2);
+		TS_ASSERT(!h.contains(2));
+		TS_ASSERT_EQUALS(h.getVal(1, 0), 10);
+		TS_ASSERT_EQUALS(h.getVal(3, 0), 30);
+		TS_ASSERT_EQUALS(h.getVal(4, 0), 40);
+		TS_ASSERT_EQUALS(h.getVal(5, 0), 50);
+		h.erase(1);
+		TS_ASSERT(!h.contains(1));
+		TS_ASSERT_EQUALS(h.getVal(3, 0), 30);
+		TS_ASSERT_EQUALS(h.getVal(4, 0), 40);
+		TS_ASSERT_EQUALS(h.getVal(5, 0), 50);
+		TS_ASSERT_EQUALS(h.size(), 3u);
+		h[2] = 20;
+		TS_ASSERT_EQUALS(h.getVal(2, 0), 20);
+		TS_ASSERT_EQUALS(h.size(), 4u);
+		h.erase(5);
+		h.erase(3);
+		h.erase(2);
+		TS_ASSERT_EQUALS(h.getVal(4, 0), 40);
+		h.erase(4);
+		TS_ASSERT(h.empty());
+	}
+
+	void test_flat_lookup_iterator() {
+		Common::FlatHashMap<Common::String, int> container;
+		container["foo"] = 1;
+		container.setVal("bar", 2);
+		TS_ASSERT_EQUALS(container.getVal("bar"), 2);
+		TS_ASSERT_EQUALS(container.getVal("quux", 17), 17);
+		TS_ASSERT(container.find("quux") == container.end());
+		TS_ASSERT_EQUALS(container.find("foo")->_value, 1);
+
+		int sum = 0;
+		Common::FlatHashMap<Common::String, int>::const_iterator i;
+		for (i = container.begin(); i != container.end(); ++i)
+			sum += i->_value;
+		TS_ASSERT_EQUALS(sum, 3);
+
+		Common::FlatHashMap<Common::String, int> copy(container);
+		container.clear(true);
+		TS_ASSERT(container.empty());
+		TS_ASSERT_EQUALS(copy["foo"], 1);
+		TS_ASSERT_EQUALS(copy.size(), 2u);
+	}
+
+	void test_flat_matches_hashmap() {
+		// Run the same sequence of insertions, lookups and erases on both
+		// map types, enough to make both grow several times.
+		Common::HashMap<uint, uint> reference;
+		Common::FlatHashMap<uint, uint> flat;
+		uint seed = 1;
+		for (uint i = 0; i < 20000; ++i) {
+			seed = seed * 1103515245 + 12345;
+			const uint key = (seed >> 16) % 4096;
+			switch (seed % 3) {
+			case 0:
+				reference[key] = i;
+				flat[key] = i;
+				break;
+			case 1:
+				reference.erase(key);
+				flat.erase(key);
+				break;
+			default:
+				TS_ASSERT_EQUALS(reference.contains(key), flat.contains(key));
+				TS_ASSERT_EQUALS(reference.getVal(key, 0), flat.getVal(key, 0));
+			}
+		}
+
+		TS_ASSERT_EQUALS(reference.size(), flat.size());
+		uint count = 0;
+		for (Common::FlatHashMap<uint, uint>::iterator i = flat.begin(); i != flat.end(); ++i, ++count)
+			TS_ASSERT_EQUALS(reference[i->_key], i->_value);
+		TS_ASSERT_EQUALS(count, flat.size());
+	}
+
 	// TODO: Add test cases for iterators, find, ...
 };
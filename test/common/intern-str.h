@@ -0,0 +1,54 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/intern-str.h"
+
+class InternedStringTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_intern() {
+		Common::InternedString a("Foo.bar");
+		Common::InternedString b(Common::String("Foo") + ".bar");
+		Common::InternedString c("foo.bar");
+
+		TS_ASSERT(a == b);
+		TS_ASSERT(a != c);
+		TS_ASSERT_EQUALS(a.c_str(), b.c_str());
+		TS_ASSERT_EQUALS(a.toString(), "Foo.bar");
+		TS_ASSERT_EQUALS(a.hash(), Common::hashit("Foo.bar"));
+
+		TS_ASSERT(a.equalsIgnoreCase(c));
+		TS_ASSERT(a.toLowercase() == c);
+		TS_ASSERT_EQUALS(a.hashIgnoreCase(), c.hash());
+		TS_ASSERT_EQUALS(a.hashIgnoreCase(), Common::hashit_lower("Foo.bar"));
+	}
+
+	void test_empty() {
+		Common::InternedString a;
+		Common::InternedString b("");
+		TS_ASSERT(a.empty());
+		TS_ASSERT(a == b);
+		TS_ASSERT_EQUALS(a.size(), 0u);
+	}
+
+	void test_find() {
+		Common::InternedString result;
+		TS_ASSERT(!Common::InternedString::find("InternedStringTestSuite::test_find", result));
+
+		Common::InternedString a("InternedStringTestSuite::test_find");
+		TS_ASSERT(Common::InternedString::find("InternedStringTestSuite::test_find", result));
+		TS_ASSERT(result == a);
+	}
+
+	void test_hashmap_key() {
+		Common::HashMap<Common::InternedString, int> map;
+		map[Common::InternedString("one")] = 1;
+		map[Common::InternedString("two")] = 2;
+		TS_ASSERT_EQUALS(map[Common::InternedString("one")], 1);
+		TS_ASSERT(!map.contains(Common::InternedString("ONE")));
+
+		Common::HashMap<Common::InternedString, int, Common::InternedStringIgnoreCase_Hash, Common::InternedStringIgnoreCase_EqualTo> mapIgnoreCase;
+		mapIgnoreCase[Common::InternedString("Data.Pak")] = 3;
+		TS_ASSERT(mapIgnoreCase.contains(Common::InternedString("DATA.PAK")));
+		TS_ASSERT_EQUALS(mapIgnoreCase[Common::InternedString("data.pak")], 3);
+	}
+};
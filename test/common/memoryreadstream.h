@@ -100,4 +100,20 @@ class MemoryReadStreamTestSuite : public CxxTest::TestSuite {
 		ms.seek(0, SEEK_SET);
 		TS_ASSERT(!ms.eos());
 	}
+
+	void test_read_array() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		uint16 words[2];
+		TS_ASSERT_EQUALS(ms.readUint16LEArray(words, 2), 2u);
+		TS_ASSERT_EQUALS(words[0], 0x0201);
+		TS_ASSERT_EQUALS(words[1], 0x0403);
+
+		uint32 dwords[2];
+		TS_ASSERT_EQUALS(ms.readUint32BEArray(dwords, 2), 1u);
+		TS_ASSERT_EQUALS(dwords[0], 0x05060708UL);
+		TS_ASSERT_EQUALS(dwords[1], 0u);
+		TS_ASSERT(ms.eos());
+	}
 };
@@ -0,0 +1,51 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/zlib.h"
+#include "common/memstream.h"
+
+class ZlibTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_seek() {
+#if defined(USE_ZLIB)
+		// Large enough for the compressor to emit several blocks
+		const uint32 dataSize = 200000;
+		byte *data = new byte[dataSize];
+		for (uint32 i = 0; i < dataSize; ++i)
+			data[i] = (byte)((i * 7) ^ (i >> 8));
+
+		Common::MemoryWriteStreamDynamic *mem = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+		Common::WriteStream *out = Common::wrapCompressedWriteStream(mem);
+		TS_ASSERT_EQUALS(out->write(data, 1000), 1000u);
+		TS_ASSERT_EQUALS(out->write(data + 1000, dataSize - 1000), dataSize - 1000);
+		out->finalize();
+		TS_ASSERT(!out->err());
+		byte *compressed = mem->getData();
+		uint32 compressedSize = mem->size();
+		delete out;
+
+		Common::SeekableReadStream *in = Common::wrapCompressedReadStream(
+			new Common::MemoryReadStream(compressed, compressedSize, DisposeAfterUse::YES));
+		TS_ASSERT_EQUALS(in->size(), (int32)dataSize);
+
+		// Jump around, both backward and forward
+		const uint32 positions[] = { 150000, 10, 65536, 65535, 131080, 70000, 199999, 0 };
+		for (uint i = 0; i < ARRAYSIZE(positions); ++i) {
+			TS_ASSERT(in->seek(positions[i]));
+			TS_ASSERT_EQUALS(in->pos(), (int32)positions[i]);
+			TS_ASSERT_EQUALS(in->readByte(), data[positions[i]]);
+		}
+
+		// Reading the whole stream still works after seeking
+		in->seek(0);
+		byte *result = new byte[dataSize];
+		TS_ASSERT_EQUALS(in->read(result, dataSize), dataSize);
+		TS_ASSERT(memcmp(result, data, dataSize) == 0);
+		in->readByte();
+		TS_ASSERT(in->eos());
+
+		delete[] result;
+		delete in;
+		delete[] data;
+#endif
+	}
+};
@@ -376,8 +376,7 @@ bool SmackerDecoder::loadStream(Common::SeekableReadStream *stream) {
 	_header.dummy = _fileStream->readUint32LE();
 
 	_frameSizes = new uint32[frameCount];
-	for (i = 0; i < frameCount; ++i)
-		_frameSizes[i] = _fileStream->readUint32LE();
+	_fileStream->readUint32LEArray(_frameSizes, frameCount);
 
 	_frameTypes = new byte[frameCount];
 	for (i = 0; i < frameCount; ++i)